@@ -0,0 +1,152 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#ifndef STL_ALLOCATOR_HPP
+#define STL_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace stl {
+
+    // 分配器可选的原地扩容接口，Vector 在扩容时会优先尝试:
+    //     bool expand(T *p, size_t old_n, size_t new_n)      不移动内存地扩容，任意类型都可以使用
+    //     T *reallocate(T *p, size_t old_n, size_t new_n)    可能按字节移动内存，只用于可平凡重定位的类型，
+    //                                                        失败时返回 nullptr 且原内存保持不变
+    // 以及 shrink_to_fit 时使用的原地缩容接口:
+    //     bool shrink(T *p, size_t old_n, size_t new_n)      把容量缩小到 new_n 并归还多余的内存，地址不变
+    // 带内嵌缓冲区的分配器还可以提供下面的接口，统计内存分配时不把内嵌缓冲区计入:
+    //     bool is_inline(const T *p) const                   p 是否为内嵌缓冲区
+    template<typename A, typename = void>
+    inline constexpr bool has_expand_v = false;
+
+    template<typename A>
+    inline constexpr bool has_expand_v<A, std::void_t<decltype(std::declval<A &>().expand(
+            std::declval<typename A::value_type *>(), size_t(), size_t()))>> = true;
+
+    template<typename A, typename = void>
+    inline constexpr bool has_reallocate_v = false;
+
+    template<typename A>
+    inline constexpr bool has_reallocate_v<A, std::void_t<decltype(std::declval<A &>().reallocate(
+            std::declval<typename A::value_type *>(), size_t(), size_t()))>> = true;
+
+    template<typename A, typename = void>
+    inline constexpr bool has_shrink_v = false;
+
+    template<typename A>
+    inline constexpr bool has_shrink_v<A, std::void_t<decltype(std::declval<A &>().shrink(
+            std::declval<typename A::value_type *>(), size_t(), size_t()))>> = true;
+
+    template<typename A, typename = void>
+    inline constexpr bool has_is_inline_v = false;
+
+    template<typename A>
+    inline constexpr bool has_is_inline_v<A, std::void_t<decltype(std::declval<const A &>().is_inline(
+            std::declval<const typename A::value_type *>()))>> = true;
+
+    // 基于 malloc/realloc 的分配器，glibc 对大块内存的 realloc 会直接使用 mremap 而不拷贝
+    template<typename T>
+    struct MallocAllocator {
+        static_assert(alignof(T) <= alignof(std::max_align_t), "realloc cannot keep over-aligned memory");
+
+        using value_type = T;
+        using is_always_equal = std::true_type;
+
+        MallocAllocator() noexcept = default;
+
+        template<typename U>
+        MallocAllocator(const MallocAllocator<U> &) noexcept {}
+
+        T *allocate(size_t n) {
+            void *p = std::malloc(n * sizeof(T));
+            if (p == nullptr && n != 0) throw std::bad_alloc();
+            return static_cast<T *>(p);
+        }
+
+        void deallocate(T *p, size_t) noexcept {
+            std::free(p);
+        }
+
+        T *reallocate(T *p, size_t, size_t new_n) noexcept {
+            return static_cast<T *>(std::realloc(p, new_n * sizeof(T)));
+        }
+
+        template<typename U>
+        bool operator==(const MallocAllocator<U> &) const noexcept { return true; }
+
+        template<typename U>
+        bool operator!=(const MallocAllocator<U> &) const noexcept { return false; }
+    };
+
+#if defined(__linux__)
+    // 直接使用 mmap 按页申请的分配器，适合很大的缓冲区:
+    // expand 用不带 MREMAP_MAYMOVE 的 mremap 在原地址扩展，reallocate 允许内核移动页表而不拷贝数据
+    template<typename T>
+    struct MmapAllocator {
+        using value_type = T;
+        using is_always_equal = std::true_type;
+
+        MmapAllocator() noexcept = default;
+
+        template<typename U>
+        MmapAllocator(const MmapAllocator<U> &) noexcept {}
+
+        static size_t page_size() noexcept {
+            static const size_t size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+            return size;
+        }
+
+        static size_t bytes(size_t n) noexcept {
+            return (n * sizeof(T) + page_size() - 1) & ~(page_size() - 1);
+        }
+
+        T *allocate(size_t n) {
+            if (n == 0) n = 1;
+            void *p = ::mmap(nullptr, bytes(n), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (p == MAP_FAILED) throw std::bad_alloc();
+            return static_cast<T *>(p);
+        }
+
+        void deallocate(T *p, size_t n) noexcept {
+            ::munmap(p, bytes(n ? n : 1));
+        }
+
+        bool expand(T *p, size_t old_n, size_t new_n) noexcept {
+            const size_t old_bytes = bytes(old_n ? old_n : 1), new_bytes = bytes(new_n);
+            if (new_bytes <= old_bytes) return true;
+            return ::mremap(p, old_bytes, new_bytes, 0) != MAP_FAILED;
+        }
+
+        T *reallocate(T *p, size_t old_n, size_t new_n) noexcept {
+            void *q = ::mremap(p, bytes(old_n ? old_n : 1), bytes(new_n), MREMAP_MAYMOVE);
+            return q == MAP_FAILED ? nullptr : static_cast<T *>(q);
+        }
+
+        // 缩小映射总是可以原地完成
+        bool shrink(T *p, size_t old_n, size_t new_n) noexcept {
+            if (new_n == 0) return false;
+            const size_t old_bytes = bytes(old_n), new_bytes = bytes(new_n);
+            return new_bytes == old_bytes || ::mremap(p, old_bytes, new_bytes, 0) != MAP_FAILED;
+        }
+
+        template<typename U>
+        bool operator==(const MmapAllocator<U> &) const noexcept { return true; }
+
+        template<typename U>
+        bool operator!=(const MmapAllocator<U> &) const noexcept { return false; }
+    };
+#endif
+
+} // namespace stl
+
+#endif //STL_ALLOCATOR_HPP
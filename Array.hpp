@@ -7,7 +7,9 @@
 
 #include <cstdio>
 #include <cstdint>
+#include <cstring>
 #include <stdexcept>
+#include "Simd.hpp"
 
 namespace stl {
 
@@ -30,8 +32,12 @@ namespace stl {
         ~Array() = default;
 
         void fill(const T &value) {
-            for (size_t i = 0; i < N; ++i) {
-                m_data[i] = value;
+            if constexpr (simd::is_simd_type_v<T>) {
+                simd::fill(m_data, N, value);
+            } else {
+                for (size_t i = 0; i < N; ++i) {
+                    m_data[i] = value;
+                }
             }
         }
 
@@ -198,6 +204,29 @@ namespace stl {
             return true;
         }
     };
+
+    template<typename T, size_t N>
+    bool operator==(const Array<T, N> &a, const Array<T, N> &b) {
+        if constexpr (N == 0) {
+            return true;
+        } else if constexpr (is_trivially_comparable_v<T>) {
+            return std::memcmp(a.data(), b.data(), sizeof(T) * N) == 0;
+        } else if constexpr (simd::is_simd_type_v<T>) {
+            return simd::equal(a.data(), b.data(), N);
+        } else {
+            for (size_t i = 0; i < N; ++i) {
+                if (a[i] != b[i]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    template<typename T, size_t N>
+    bool operator!=(const Array<T, N> &a, const Array<T, N> &b) {
+        return !(a == b);
+    }
 } // namespace stl
 
 #endif //STL_ARRAY_HPP
@@ -0,0 +1,446 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#ifndef STL_BITVECTOR_HPP
+#define STL_BITVECTOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include "Simd.hpp"
+#include "Vector.hpp"
+
+namespace stl {
+
+    namespace detail {
+
+        inline size_t popcount64(uint64_t word) noexcept {
+            return static_cast<size_t>(__builtin_popcountll(word));
+        }
+
+        // word 中第 k 个 (从 0 开始) 置位的下标，要求 k < popcount64(word)
+        inline size_t select64(uint64_t word, size_t k) noexcept {
+            for (; k; --k) word &= word - 1;
+            return static_cast<size_t>(__builtin_ctzll(word));
+        }
+
+    } // namespace detail
+
+    // 按 64 位字存储的位向量，每个标志只占一位。最后一个字中超出 size() 的位始终为 0，
+    // 所以 count 和按字的位运算不需要额外处理尾部。
+    // rank/select 在调用 build_index() 后使用两级索引：每 4096 位一个 64 位累计值，
+    // 每 512 位一个相对于所在超块的 16 位累计值，额外空间约为 4.7%。
+    // 任何修改都会使索引失效，此时 rank/select 退化为线性扫描
+    class BitVector {
+    private:
+        static constexpr size_t word_bits = 64;
+        static constexpr size_t block_words = 8;
+        static constexpr size_t super_words = 64;
+
+        Vector<uint64_t> m_words;
+        size_t m_size;
+
+        Vector<uint64_t> m_super;
+        Vector<uint16_t> m_block;
+        size_t m_total;
+        bool m_indexed;
+
+        static size_t words_for(size_t bits) noexcept {
+            return (bits + word_bits - 1) / word_bits;
+        }
+
+        static uint64_t bit_mask(size_t i) noexcept {
+            return uint64_t(1) << (i % word_bits);
+        }
+
+        // 清除最后一个字中超出 size() 的位
+        void trim() noexcept {
+            if (m_size % word_bits) {
+                m_words.back() &= (uint64_t(1) << (m_size % word_bits)) - 1;
+            }
+        }
+
+        void check(size_t i) const {
+            if (i >= m_size) {
+                throw std::out_of_range(out_of_range);
+            }
+        }
+
+        void check_size(const BitVector &other) const {
+            if (m_size != other.m_size) {
+                throw std::invalid_argument("bit vector sizes differ");
+            }
+        }
+
+        // 从第 w 个字开始的第一个置位
+        size_t scan(size_t w) const noexcept {
+            for (; w < m_words.size(); ++w) {
+                if (m_words[w]) {
+                    return w * word_bits + static_cast<size_t>(__builtin_ctzll(m_words[w]));
+                }
+            }
+            return npos;
+        }
+
+        // 从第 w 个字开始找第 k 个置位
+        size_t select_from(size_t w, size_t k) const noexcept {
+            for (; w < m_words.size(); ++w) {
+                const size_t c = detail::popcount64(m_words[w]);
+                if (k < c) return w * word_bits + detail::select64(m_words[w], k);
+                k -= c;
+            }
+            return npos;
+        }
+
+    public:
+        static constexpr size_t npos = size_t(-1);
+
+        inline static const char *out_of_range = "bit vector subscript out of range";
+
+        // 单个位的代理引用
+        class reference {
+        private:
+            BitVector *m_owner;
+            size_t m_index;
+
+            friend class BitVector;
+
+            reference(BitVector *owner, size_t index) noexcept : m_owner(owner), m_index(index) {}
+
+        public:
+            reference(const reference &) = default;
+
+            reference &operator=(bool value) noexcept {
+                m_owner->set(m_index, value);
+                return *this;
+            }
+
+            reference &operator=(const reference &other) noexcept {
+                return *this = static_cast<bool>(other);
+            }
+
+            operator bool() const noexcept {
+                return m_owner->test(m_index);
+            }
+
+            bool operator~() const noexcept {
+                return !static_cast<bool>(*this);
+            }
+
+            reference &flip() noexcept {
+                m_owner->flip(m_index);
+                return *this;
+            }
+        };
+
+        BitVector() noexcept : m_size(0), m_total(0), m_indexed(false) {}
+
+        explicit BitVector(size_t n, bool value = false)
+                : m_words(words_for(n), value ? ~uint64_t(0) : 0), m_size(n), m_total(0), m_indexed(false) {
+            trim();
+        }
+
+        size_t size() const noexcept {
+            return m_size;
+        }
+
+        bool empty() const noexcept {
+            return m_size == 0;
+        }
+
+        // 以位计的容量
+        size_t capacity() const noexcept {
+            return m_words.capacity() * word_bits;
+        }
+
+        void reserve(size_t n) {
+            m_words.reverse(words_for(n));
+        }
+
+        void shrink_to_fit() {
+            m_words.shrink_to_fit();
+        }
+
+        void clear() noexcept {
+            m_words.clear();
+            m_size = 0;
+            m_indexed = false;
+        }
+
+        // 底层的字，按位从低到高存放
+        const uint64_t *words() const noexcept {
+            return m_words.data();
+        }
+
+        size_t word_count() const noexcept {
+            return m_words.size();
+        }
+
+        bool test(size_t i) const noexcept {
+            return m_words[i / word_bits] & bit_mask(i);
+        }
+
+        bool operator[](size_t i) const noexcept {
+            return test(i);
+        }
+
+        reference operator[](size_t i) noexcept {
+            return reference(this, i);
+        }
+
+        bool at(size_t i) const {
+            check(i);
+            return test(i);
+        }
+
+        reference at(size_t i) {
+            check(i);
+            return reference(this, i);
+        }
+
+        void set(size_t i, bool value = true) noexcept {
+            if (value) {
+                m_words[i / word_bits] |= bit_mask(i);
+            } else {
+                m_words[i / word_bits] &= ~bit_mask(i);
+            }
+            m_indexed = false;
+        }
+
+        void reset(size_t i) noexcept {
+            set(i, false);
+        }
+
+        void flip(size_t i) noexcept {
+            m_words[i / word_bits] ^= bit_mask(i);
+            m_indexed = false;
+        }
+
+        void set() noexcept {
+            for (uint64_t &word : m_words) word = ~uint64_t(0);
+            trim();
+            m_indexed = false;
+        }
+
+        void reset() noexcept {
+            for (uint64_t &word : m_words) word = 0;
+            m_indexed = false;
+        }
+
+        void flip() noexcept {
+            for (uint64_t &word : m_words) word = ~word;
+            trim();
+            m_indexed = false;
+        }
+
+        void push_back(bool value) {
+            if (m_size % word_bits == 0) {
+                m_words.push_back(0);
+            }
+            ++m_size;
+            set(m_size - 1, value);
+        }
+
+        void pop_back() {
+            if (m_size == 0) {
+                throw std::runtime_error("bit vector is empty");
+            }
+            --m_size;
+            if (m_size % word_bits == 0) {
+                m_words.pop_back();
+            } else {
+                trim();
+            }
+            m_indexed = false;
+        }
+
+        void resize(size_t n, bool value = false) {
+            const size_t old = m_size;
+            m_words.resize(words_for(n), value ? ~uint64_t(0) : 0);
+            m_size = n;
+            // 原来最后一个字的空闲位也要填上 value
+            if (value && n > old && old % word_bits) {
+                m_words[old / word_bits] |= ~uint64_t(0) << (old % word_bits);
+            }
+            trim();
+            m_indexed = false;
+        }
+
+        // 置位的总数
+        size_t count() const noexcept {
+            return m_indexed ? m_total : simd::popcount(m_words.data(), m_words.size());
+        }
+
+        bool any() const noexcept {
+            return scan(0) != npos;
+        }
+
+        bool none() const noexcept {
+            return !any();
+        }
+
+        bool all() const noexcept {
+            return count() == m_size;
+        }
+
+        // 第一个置位的下标，没有时返回 npos
+        size_t find_first() const noexcept {
+            return scan(0);
+        }
+
+        // 下标大于 i 的第一个置位，没有时返回 npos
+        size_t find_next(size_t i) const noexcept {
+            if (++i >= m_size) return npos;
+            const uint64_t rest = m_words[i / word_bits] & (~uint64_t(0) << (i % word_bits));
+            if (rest) {
+                return i / word_bits * word_bits + static_cast<size_t>(__builtin_ctzll(rest));
+            }
+            return scan(i / word_bits + 1);
+        }
+
+        // 建立 rank/select 索引，修改之后需要重新调用
+        void build_index() {
+            const size_t n = m_words.size();
+            Vector<uint64_t> super(n / super_words + 1, 0);
+            Vector<uint16_t> block(n / block_words + 1, 0);
+            size_t total = 0, base = 0;
+            for (size_t w = 0; w < n; ++w) {
+                if (w % super_words == 0) {
+                    super[w / super_words] = base = total;
+                }
+                if (w % block_words == 0) {
+                    block[w / block_words] = static_cast<uint16_t>(total - base);
+                }
+                total += detail::popcount64(m_words[w]);
+            }
+            // n 恰好落在块边界上时 rank(size()) 会用到末尾的项
+            if (n % super_words == 0) {
+                super[n / super_words] = base = total;
+            }
+            if (n % block_words == 0) {
+                block[n / block_words] = static_cast<uint16_t>(total - base);
+            }
+            m_super.swap(super);
+            m_block.swap(block);
+            m_total = total;
+            m_indexed = true;
+        }
+
+        bool has_index() const noexcept {
+            return m_indexed;
+        }
+
+        // [0, i) 中置位的个数，i 可以等于 size()
+        size_t rank(size_t i) const {
+            if (i > m_size) {
+                throw std::out_of_range(out_of_range);
+            }
+            const size_t w = i / word_bits;
+            size_t result = 0, start = 0;
+            if (m_indexed) {
+                result = m_super[w / super_words] + m_block[w / block_words];
+                start = w - w % block_words;
+            }
+            result += simd::popcount(m_words.data() + start, w - start);
+            if (i % word_bits) {
+                result += detail::popcount64(m_words[w] & (bit_mask(i) - 1));
+            }
+            return result;
+        }
+
+        // 第 k 个 (从 0 开始) 置位的下标，k >= count() 时返回 npos
+        size_t select(size_t k) const noexcept {
+            if (!m_indexed) return select_from(0, k);
+            if (k >= m_total) return npos;
+            // 最后一个累计值不超过 k 的超块
+            size_t lo = 0, hi = m_words.size() / super_words + 1;
+            while (hi - lo > 1) {
+                const size_t mid = lo + (hi - lo) / 2;
+                if (m_super[mid] <= k) lo = mid; else hi = mid;
+            }
+            k -= m_super[lo];
+            size_t b = lo * (super_words / block_words);
+            const size_t last = std::min((lo + 1) * (super_words / block_words), m_words.size() / block_words + 1);
+            while (b + 1 < last && m_block[b + 1] <= k) ++b;
+            return select_from(b * block_words, k - m_block[b]);
+        }
+
+        // 按字的位运算，两个位向量的长度必须相同
+        BitVector &operator&=(const BitVector &other) {
+            check_size(other);
+            simd::bit_and(reinterpret_cast<const int64_t *>(m_words.data()),
+                          reinterpret_cast<const int64_t *>(other.m_words.data()),
+                          reinterpret_cast<int64_t *>(m_words.data()), m_words.size());
+            m_indexed = false;
+            return *this;
+        }
+
+        BitVector &operator|=(const BitVector &other) {
+            check_size(other);
+            simd::bit_or(reinterpret_cast<const int64_t *>(m_words.data()),
+                         reinterpret_cast<const int64_t *>(other.m_words.data()),
+                         reinterpret_cast<int64_t *>(m_words.data()), m_words.size());
+            m_indexed = false;
+            return *this;
+        }
+
+        BitVector &operator^=(const BitVector &other) {
+            check_size(other);
+            simd::bit_xor(reinterpret_cast<const int64_t *>(m_words.data()),
+                          reinterpret_cast<const int64_t *>(other.m_words.data()),
+                          reinterpret_cast<int64_t *>(m_words.data()), m_words.size());
+            m_indexed = false;
+            return *this;
+        }
+
+        // 清除 other 中置位的位，即 *this &= ~other
+        BitVector &andnot(const BitVector &other) {
+            check_size(other);
+            simd::bit_andnot(reinterpret_cast<const int64_t *>(m_words.data()),
+                             reinterpret_cast<const int64_t *>(other.m_words.data()),
+                             reinterpret_cast<int64_t *>(m_words.data()), m_words.size());
+            m_indexed = false;
+            return *this;
+        }
+
+        BitVector operator~() const {
+            BitVector result(*this);
+            result.flip();
+            return result;
+        }
+
+        void swap(BitVector &other) noexcept {
+            m_words.swap(other.m_words);
+            m_super.swap(other.m_super);
+            m_block.swap(other.m_block);
+            std::swap(m_size, other.m_size);
+            std::swap(m_total, other.m_total);
+            std::swap(m_indexed, other.m_indexed);
+        }
+
+        friend BitVector operator&(BitVector a, const BitVector &b) {
+            return a &= b;
+        }
+
+        friend BitVector operator|(BitVector a, const BitVector &b) {
+            return a |= b;
+        }
+
+        friend BitVector operator^(BitVector a, const BitVector &b) {
+            return a ^= b;
+        }
+
+        friend bool operator==(const BitVector &a, const BitVector &b) {
+            return a.m_size == b.m_size && a.m_words == b.m_words;
+        }
+
+        friend bool operator!=(const BitVector &a, const BitVector &b) {
+            return !(a == b);
+        }
+    };
+
+} // namespace stl
+
+#endif //STL_BITVECTOR_HPP
@@ -0,0 +1,434 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#ifndef STL_CONCURRENTVECTOR_HPP
+#define STL_CONCURRENTVECTOR_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include "Uninitialized.hpp"
+#include "Utility.hpp"
+
+namespace stl {
+
+    // 分段存储的并发向量: 第 0 段容纳 first_segment 个元素，之后第 s 段容纳 first_segment << (s - 1) 个，
+    // 每段大小都是 2 的幂，下标到段号只需一次 clz；段一旦分配就不再移动，元素地址始终有效
+    //
+    // push_back / emplace_back / grow_by / reserve 可以被多个线程同时调用，追加通过一次 fetch_add 领取下标，
+    // 新的段用 CAS 安装，不需要加锁；读取已经构造完成的元素也可以与追加并发进行。
+    // size() 包含已被领取但可能仍在构造中的位置，读者应只访问由追加方交给它的下标。
+    // 构造、析构、赋值、clear、swap 都不是线程安全的，不能与其他任何操作并发进行
+    template<typename T, typename Alloc = std::allocator<T>>
+    class ConcurrentVector : private Alloc {
+    private:
+        using alloc_traits = std::allocator_traits<Alloc>;
+
+        static constexpr size_t first_bits = 3;
+        static constexpr size_t first_segment = size_t(1) << first_bits;
+        static constexpr size_t segment_count = 64 - first_bits + 1;
+
+        std::atomic<T *> m_segments[segment_count];
+        std::atomic<size_t> m_size;
+
+        static size_t segment_of(size_t i) noexcept {
+            const size_t high = i >> first_bits;
+            return high ? 64 - __builtin_clzll(high) : 0;
+        }
+
+        static size_t segment_base(size_t s) noexcept {
+            return s ? first_segment << (s - 1) : 0;
+        }
+
+        static size_t segment_size(size_t s) noexcept {
+            return s ? first_segment << (s - 1) : first_segment;
+        }
+
+        Alloc &alloc() noexcept {
+            return *this;
+        }
+
+        const Alloc &alloc() const noexcept {
+            return *this;
+        }
+
+        // 多个线程可能同时为同一段申请内存，只有一个能安装成功，其余的释放自己的内存；
+        // 段内存申请失败时无法归还已领取的下标，因此直接终止程序
+        T *segment(size_t s) noexcept {
+            T *data = m_segments[s].load(std::memory_order_acquire);
+            if (data) return data;
+            T *fresh = alloc_traits::allocate(alloc(), segment_size(s));
+            if (m_segments[s].compare_exchange_strong(data, fresh, std::memory_order_acq_rel)) {
+                return fresh;
+            }
+            alloc_traits::deallocate(alloc(), fresh, segment_size(s));
+            return data;
+        }
+
+        T *slot(size_t i) noexcept {
+            const size_t s = segment_of(i);
+            return segment(s) + (i - segment_base(s));
+        }
+
+        // 领取 [first, first + n) 中每个位置所在的段，返回 first
+        size_t claim(size_t n) noexcept {
+            const size_t first = m_size.fetch_add(n, std::memory_order_relaxed);
+            if (n) {
+                for (size_t s = segment_of(first), last = segment_of(first + n - 1); s <= last; ++s) {
+                    segment(s);
+                }
+            }
+            return first;
+        }
+
+        void free() noexcept {
+            clear();
+            for (size_t s = 0; s < segment_count; ++s) {
+                if (T *data = m_segments[s].load(std::memory_order_relaxed)) {
+                    alloc_traits::deallocate(alloc(), data, segment_size(s));
+                    m_segments[s].store(nullptr, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        template<bool Const>
+        class basic_iterator {
+        private:
+            friend ConcurrentVector;
+            using owner = std::conditional_t<Const, const ConcurrentVector, ConcurrentVector>;
+
+            owner *m_vector;
+            size_t m_index;
+
+            basic_iterator(owner *vector, size_t index) : m_vector(vector), m_index(index) {}
+
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = T;
+            using difference_type = ptrdiff_t;
+            using pointer = std::conditional_t<Const, const T *, T *>;
+            using reference = std::conditional_t<Const, const T &, T &>;
+
+            basic_iterator() : m_vector(nullptr), m_index(0) {}
+
+            // iterator 可以隐式转换为 const_iterator
+            template<bool C = Const, std::enable_if_t<C, int> = 0>
+            basic_iterator(const basic_iterator<false> &other) : m_vector(other.m_vector), m_index(other.m_index) {}
+
+            reference operator*() const {
+                return (*m_vector)[m_index];
+            }
+
+            pointer operator->() const {
+                return &(*m_vector)[m_index];
+            }
+
+            reference operator[](difference_type n) const {
+                return (*m_vector)[m_index + n];
+            }
+
+            basic_iterator &operator++() {
+                ++m_index;
+                return *this;
+            }
+
+            basic_iterator &operator--() {
+                --m_index;
+                return *this;
+            }
+
+            basic_iterator operator++(int) {
+                basic_iterator temp = *this;
+                ++m_index;
+                return temp;
+            }
+
+            basic_iterator operator--(int) {
+                basic_iterator temp = *this;
+                --m_index;
+                return temp;
+            }
+
+            basic_iterator &operator+=(difference_type n) {
+                m_index += n;
+                return *this;
+            }
+
+            basic_iterator &operator-=(difference_type n) {
+                m_index -= n;
+                return *this;
+            }
+
+            basic_iterator operator+(difference_type n) const {
+                return basic_iterator(m_vector, m_index + n);
+            }
+
+            friend basic_iterator operator+(difference_type n, const basic_iterator &iter) {
+                return iter + n;
+            }
+
+            basic_iterator operator-(difference_type n) const {
+                return basic_iterator(m_vector, m_index - n);
+            }
+
+            difference_type operator-(const basic_iterator &other) const {
+                return static_cast<difference_type>(m_index - other.m_index);
+            }
+
+            bool operator==(const basic_iterator &other) const {
+                return m_index == other.m_index;
+            }
+
+            bool operator!=(const basic_iterator &other) const {
+                return m_index != other.m_index;
+            }
+
+            bool operator<(const basic_iterator &other) const {
+                return m_index < other.m_index;
+            }
+
+            bool operator>(const basic_iterator &other) const {
+                return m_index > other.m_index;
+            }
+
+            bool operator<=(const basic_iterator &other) const {
+                return m_index <= other.m_index;
+            }
+
+            bool operator>=(const basic_iterator &other) const {
+                return m_index >= other.m_index;
+            }
+
+            // 迭代器对应的下标
+            size_t index() const noexcept {
+                return m_index;
+            }
+        };
+
+    public:
+        using allocator_type = Alloc;
+        using value_type = T;
+        using reference = T &;
+        using const_reference = const T &;
+        using iterator = basic_iterator<false>;
+        using const_iterator = basic_iterator<true>;
+
+        inline static const char *out_of_range = "concurrent vector subscript out of range";
+
+        explicit ConcurrentVector(const Alloc &alloc = Alloc()) : Alloc(alloc), m_size(0) {
+            for (std::atomic<T *> &data : m_segments) {
+                data.store(nullptr, std::memory_order_relaxed);
+            }
+        }
+
+        explicit ConcurrentVector(size_t n, const Alloc &alloc = Alloc()) : ConcurrentVector(alloc) {
+            grow_by(n);
+        }
+
+        ConcurrentVector(size_t n, const T &value, const Alloc &alloc = Alloc()) : ConcurrentVector(alloc) {
+            grow_by(n, value);
+        }
+
+        template<typename InputIt, std::enable_if_t<is_iterator_v<InputIt>, int> = 0>
+        ConcurrentVector(InputIt first, InputIt last, const Alloc &alloc = Alloc()) : ConcurrentVector(alloc) {
+            for (; first != last; ++first) {
+                push_back(*first);
+            }
+        }
+
+        ConcurrentVector(std::initializer_list<T> values, const Alloc &alloc = Alloc())
+                : ConcurrentVector(values.begin(), values.end(), alloc) {}
+
+        ConcurrentVector(const ConcurrentVector &other)
+                : ConcurrentVector(other.begin(), other.end(),
+                                   alloc_traits::select_on_container_copy_construction(other)) {}
+
+        ConcurrentVector(ConcurrentVector &&other) noexcept : ConcurrentVector(static_cast<const Alloc &>(other)) {
+            swap(other);
+        }
+
+        ~ConcurrentVector() {
+            free();
+        }
+
+        ConcurrentVector &operator=(const ConcurrentVector &other) {
+            if (this == &other) return *this;
+            if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+                if (alloc() != other.alloc()) { // 旧内存必须由旧分配器释放
+                    free();
+                }
+                alloc() = other.alloc();
+            }
+            // 临时对象使用自身的分配器，swap 不交换分配器时内存也不会错配
+            ConcurrentVector temp(other.begin(), other.end(), alloc());
+            swap(temp);
+            return *this;
+        }
+
+        ConcurrentVector &operator=(ConcurrentVector &&other) noexcept(
+                alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value) {
+            if (this == &other) return *this;
+            if constexpr (!alloc_traits::propagate_on_container_move_assignment::value) {
+                if (alloc() != other.alloc()) { // 分配器不同，只能逐个移动元素
+                    ConcurrentVector temp(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()),
+                                          alloc());
+                    swap(temp);
+                    other.clear();
+                    return *this;
+                }
+            }
+            free();
+            if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+                alloc() = std::move(other.alloc());
+            }
+            swap(other);
+            return *this;
+        }
+
+        // 交换段表，不传播分配器时两者的分配器必须相等
+        void swap(ConcurrentVector &other) noexcept {
+            if constexpr (alloc_traits::propagate_on_container_swap::value) {
+                using std::swap;
+                swap(alloc(), other.alloc());
+            }
+            for (size_t s = 0; s < segment_count; ++s) {
+                T *data = m_segments[s].load(std::memory_order_relaxed);
+                m_segments[s].store(other.m_segments[s].load(std::memory_order_relaxed), std::memory_order_relaxed);
+                other.m_segments[s].store(data, std::memory_order_relaxed);
+            }
+            const size_t size = m_size.load(std::memory_order_relaxed);
+            m_size.store(other.m_size.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            other.m_size.store(size, std::memory_order_relaxed);
+        }
+
+        // 元素先在栈上构造好再领取下标，构造抛出异常时不会留下空位
+        template<typename... Args>
+        T &emplace_back(Args &&... args) {
+            static_assert(std::is_nothrow_move_constructible_v<T>, "ConcurrentVector requires nothrow move");
+            T value(std::forward<Args>(args)...);
+            T *p = slot(claim(1));
+            return *::new(p) T(std::move(value));
+        }
+
+        T &push_back(const T &value) {
+            return emplace_back(value);
+        }
+
+        T &push_back(T &&value) {
+            return emplace_back(std::move(value));
+        }
+
+        // 一次原子操作领取连续的 n 个下标并值初始化，返回指向第一个新元素的迭代器
+        iterator grow_by(size_t n) {
+            static_assert(std::is_nothrow_default_constructible_v<T>, "grow_by requires nothrow construction");
+            const size_t first = claim(n);
+            for (size_t i = first; i < first + n;) {
+                const size_t s = segment_of(i), end = std::min(first + n, segment_base(s) + segment_size(s));
+                uninitialized_value_construct(slot(i), end - i);
+                i = end;
+            }
+            return iterator(this, first);
+        }
+
+        iterator grow_by(size_t n, const T &value) {
+            static_assert(std::is_nothrow_copy_constructible_v<T>, "grow_by requires nothrow construction");
+            const size_t first = claim(n);
+            for (size_t i = first; i < first + n; ++i) {
+                ::new(slot(i)) T(value);
+            }
+            return iterator(this, first);
+        }
+
+        // 预先分配能容纳 n 个元素的段，可以与追加并发调用
+        void reserve(size_t n) noexcept {
+            if (n == 0) return;
+            for (size_t s = 0, last = segment_of(n - 1); s <= last; ++s) {
+                segment(s);
+            }
+        }
+
+        T &operator[](size_t i) {
+            const size_t s = segment_of(i);
+            return m_segments[s].load(std::memory_order_acquire)[i - segment_base(s)];
+        }
+
+        const T &operator[](size_t i) const {
+            const size_t s = segment_of(i);
+            return m_segments[s].load(std::memory_order_acquire)[i - segment_base(s)];
+        }
+
+        T &at(size_t i) {
+            return const_cast<T &>(static_cast<const ConcurrentVector &>(*this).at(i));
+        }
+
+        const T &at(size_t i) const {
+            if (i >= size()) {
+                throw std::out_of_range(out_of_range);
+            }
+            return (*this)[i];
+        }
+
+        T &front() {
+            return at(0);
+        }
+
+        const T &front() const {
+            return at(0);
+        }
+
+        // 不能与追加并发调用
+        void clear() noexcept {
+            const size_t n = m_size.load(std::memory_order_relaxed);
+            for (size_t i = 0; i < n;) {
+                const size_t s = segment_of(i), end = std::min(n, segment_base(s) + segment_size(s));
+                T *data = m_segments[s].load(std::memory_order_relaxed);
+                stl::destroy(data + (i - segment_base(s)), data + (end - segment_base(s)));
+                i = end;
+            }
+            m_size.store(0, std::memory_order_relaxed);
+        }
+
+        size_t size() const noexcept {
+            return m_size.load(std::memory_order_acquire);
+        }
+
+        bool empty() const noexcept {
+            return size() == 0;
+        }
+
+        // 从第 0 段起连续分配的各段能容纳的元素个数
+        size_t capacity() const noexcept {
+            size_t s = 0;
+            while (s < segment_count && m_segments[s].load(std::memory_order_acquire)) ++s;
+            return segment_base(s);
+        }
+
+        iterator begin() {
+            return iterator(this, 0);
+        }
+
+        iterator end() {
+            return iterator(this, size());
+        }
+
+        const_iterator begin() const {
+            return const_iterator(this, 0);
+        }
+
+        const_iterator end() const {
+            return const_iterator(this, size());
+        }
+
+        Alloc get_allocator() const {
+            return *this;
+        }
+    };
+
+} // namespace stl
+
+#endif //STL_CONCURRENTVECTOR_HPP
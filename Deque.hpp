@@ -0,0 +1,393 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#ifndef STL_DEQUE_HPP
+#define STL_DEQUE_HPP
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "Instrument.hpp"
+#include "RingBuffer.hpp"
+#include "Uninitialized.hpp"
+#include "Utility.hpp"
+
+namespace stl {
+
+    // 分块存储的双端队列: 元素位于固定大小的块中 (约 4 KiB，至少 16 个元素)，块指针保存在 RingBuffer 中，
+    // 两端插入删除为 O(1)，且不会搬动已有元素，引用在两端插入删除其他元素时保持有效。
+    // 下标访问经过两次掩码换算；从头部弹空的块会留作备用，用作 FIFO 队列时稳态下不再分配内存
+    template<typename T, typename Alloc = std::allocator<T>>
+    class Deque : private Alloc {
+    private:
+        using alloc_traits = std::allocator_traits<Alloc>;
+        using map_allocator = typename alloc_traits::template rebind_alloc<T *>;
+        using map_type = RingBuffer<T *, map_allocator>;
+
+        static constexpr size_t block_shift() noexcept {
+            const size_t target = sizeof(T) >= 256 ? 16 : 4096 / sizeof(T);
+            size_t shift = 0;
+            while ((size_t(2) << shift) <= target) ++shift;
+            return shift;
+        }
+
+        static constexpr size_t block_size = size_t(1) << block_shift();
+        static constexpr size_t block_mask = block_size - 1;
+
+        // 元素 i 位于全局位置 m_first + i，即第 (m_first + i) / block_size 块；
+        // m_first 始终小于 block_size，且只有为空时最后一块才可能不含元素
+        map_type m_map;
+        size_t m_first;
+        size_t m_size;
+        T *m_spare; // 备用块
+
+        Alloc &alloc() noexcept {
+            return *this;
+        }
+
+        const Alloc &alloc() const noexcept {
+            return *this;
+        }
+
+        T *new_block() {
+            if (T *block = m_spare) {
+                m_spare = nullptr;
+                return block;
+            }
+            T *block = alloc_traits::allocate(alloc(), block_size);
+            instrument::allocated<Deque>(block_size * sizeof(T));
+            return block;
+        }
+
+        void free_block(T *block) noexcept {
+            instrument::freed<Deque>(block_size * sizeof(T));
+            alloc_traits::deallocate(alloc(), block, block_size);
+        }
+
+        // 留一块备用，其余释放
+        void release_block(T *block) noexcept {
+            if (m_spare == nullptr) {
+                m_spare = block;
+            } else {
+                free_block(block);
+            }
+        }
+
+        T *position(size_t pos) const noexcept {
+            return m_map[pos >> block_shift()] + (pos & block_mask);
+        }
+
+        void free() noexcept {
+            clear();
+            if (m_spare) {
+                free_block(m_spare);
+                m_spare = nullptr;
+            }
+        }
+
+    public:
+        using allocator_type = Alloc;
+        using value_type = T;
+        using reference = T &;
+        using const_reference = const T &;
+        using iterator = detail::IndexIterator<Deque, T, false>;
+        using const_iterator = detail::IndexIterator<Deque, T, true>;
+
+        inline static const char *out_of_range = "deque subscript out of range";
+
+        Deque() noexcept(std::is_nothrow_default_constructible_v<Alloc>) : Deque(Alloc()) {}
+
+        explicit Deque(const Alloc &alloc) noexcept
+                : Alloc(alloc), m_map(map_allocator(alloc)), m_first(0), m_size(0), m_spare(nullptr) {}
+
+        explicit Deque(size_t n, const T &value = T(), const Alloc &alloc = Alloc()) : Deque(alloc) {
+            try {
+                for (size_t i = 0; i < n; ++i) push_back(value);
+            } catch (...) {
+                free();
+                throw;
+            }
+        }
+
+        template<typename InputIt, std::enable_if_t<is_iterator_v<InputIt>, int> = 0>
+        Deque(InputIt first, InputIt last, const Alloc &alloc = Alloc()) : Deque(alloc) {
+            try {
+                for (; first != last; ++first) emplace_back(*first);
+            } catch (...) {
+                free();
+                throw;
+            }
+        }
+
+        Deque(std::initializer_list<T> values, const Alloc &alloc = Alloc()) : Deque(values.begin(), values.end(), alloc) {}
+
+        Deque(const Deque &other)
+                : Deque(other.begin(), other.end(), alloc_traits::select_on_container_copy_construction(other.alloc())) {}
+
+        Deque(Deque &&other) noexcept
+                : Alloc(std::move(other.alloc())), m_map(std::move(other.m_map)), m_first(other.m_first),
+                  m_size(other.m_size), m_spare(other.m_spare) {
+            other.m_first = other.m_size = 0;
+            other.m_spare = nullptr;
+        }
+
+        ~Deque() {
+            free();
+        }
+
+        Deque &operator=(const Deque &other) {
+            if (this == &other) return *this;
+            if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+                free(); // 块和块指针表都要换成新的分配器，旧内存必须由旧分配器释放
+                alloc() = other.alloc();
+                m_map = map_type(map_allocator(alloc()));
+            }
+            // 临时对象使用自身的分配器，swap 不交换分配器时内存也不会错配
+            Deque temp(other.begin(), other.end(), alloc());
+            swap(temp);
+            return *this;
+        }
+
+        Deque &operator=(Deque &&other) noexcept(alloc_traits::propagate_on_container_move_assignment::value ||
+                                                 alloc_traits::is_always_equal::value) {
+            if (this == &other) return *this;
+            if constexpr (!alloc_traits::propagate_on_container_move_assignment::value) {
+                if (alloc() != other.alloc()) { // 分配器不同，只能逐个移动元素
+                    Deque temp(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()), alloc());
+                    swap(temp);
+                    other.clear();
+                    return *this;
+                }
+            }
+            free();
+            if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+                alloc() = std::move(other.alloc());
+            }
+            m_map = std::move(other.m_map); // 块指针表随分配器一起传播
+            m_first = other.m_first;
+            m_size = other.m_size;
+            m_spare = other.m_spare;
+            other.m_first = other.m_size = 0;
+            other.m_spare = nullptr;
+            return *this;
+        }
+
+        void swap(Deque &other) noexcept {
+            using std::swap;
+            if constexpr (alloc_traits::propagate_on_container_swap::value) {
+                swap(alloc(), other.alloc());
+            }
+            m_map.swap(other.m_map);
+            swap(m_first, other.m_first);
+            swap(m_size, other.m_size);
+            swap(m_spare, other.m_spare);
+        }
+
+        template<typename ...Args>
+        T &emplace_back(Args &&... args) {
+            const size_t pos = m_first + m_size;
+            if (pos == m_map.size() << block_shift()) {
+                T value(std::forward<Args>(args)...); // 参数可能引用自身元素，分配新块之前先构造出来
+                T *block = new_block();
+                try {
+                    m_map.push_back(block);
+                } catch (...) {
+                    release_block(block);
+                    throw;
+                }
+                try {
+                    ::new(block) T(std::move_if_noexcept(value));
+                } catch (...) {
+                    m_map.pop_back();
+                    release_block(block);
+                    throw;
+                }
+                ++m_size;
+                return *block;
+            }
+            T *p = position(pos);
+            ::new(p) T(std::forward<Args>(args)...);
+            ++m_size;
+            return *p;
+        }
+
+        template<typename ...Args>
+        T &emplace_front(Args &&... args) {
+            if (m_first == 0) {
+                T value(std::forward<Args>(args)...);
+                T *block = new_block();
+                try {
+                    m_map.push_front(block);
+                } catch (...) {
+                    release_block(block);
+                    throw;
+                }
+                T *p = block + block_mask;
+                try {
+                    ::new(p) T(std::move_if_noexcept(value));
+                } catch (...) {
+                    m_map.pop_front();
+                    release_block(block);
+                    throw;
+                }
+                m_first = block_mask;
+                ++m_size;
+                return *p;
+            }
+            T *p = position(m_first - 1);
+            ::new(p) T(std::forward<Args>(args)...);
+            --m_first;
+            ++m_size;
+            return *p;
+        }
+
+        void push_back(const T &value) {
+            emplace_back(value);
+        }
+
+        void push_back(T &&value) {
+            emplace_back(std::move(value));
+        }
+
+        void push_front(const T &value) {
+            emplace_front(value);
+        }
+
+        void push_front(T &&value) {
+            emplace_front(std::move(value));
+        }
+
+        void pop_front() {
+            if (m_size == 0) {
+                throw std::runtime_error("deque is empty");
+            }
+            position(m_first)->~T();
+            --m_size;
+            if (++m_first == block_size) {
+                release_block(m_map.front());
+                m_map.pop_front();
+                m_first = 0;
+            } else if (m_size == 0 && m_map.size() == 1) { // 唯一的块变空时从头开始使用
+                m_first = 0;
+            }
+        }
+
+        void pop_back() {
+            if (m_size == 0) {
+                throw std::runtime_error("deque is empty");
+            }
+            --m_size;
+            position(m_first + m_size)->~T();
+            if (m_first + m_size <= (m_map.size() - 1) << block_shift()) {
+                release_block(m_map.back());
+                m_map.pop_back();
+                if (m_map.empty()) m_first = 0;
+            }
+        }
+
+        T &operator[](size_t i) {
+            return *position(m_first + i);
+        }
+
+        const T &operator[](size_t i) const {
+            return *position(m_first + i);
+        }
+
+        T &at(size_t i) {
+            return const_cast<T &>(static_cast<const Deque &>(*this).at(i));
+        }
+
+        const T &at(size_t i) const {
+            if (i >= m_size) {
+                throw std::out_of_range(out_of_range);
+            }
+            return *position(m_first + i);
+        }
+
+        T &front() {
+            return at(0);
+        }
+
+        const T &front() const {
+            return at(0);
+        }
+
+        T &back() {
+            return at(m_size - 1);
+        }
+
+        const T &back() const {
+            return at(m_size - 1);
+        }
+
+        // 析构所有元素并释放所有块 (保留一块备用)
+        void clear() noexcept {
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                for (size_t i = 0; i < m_size; ++i) position(m_first + i)->~T();
+            }
+            while (!m_map.empty()) {
+                release_block(m_map.back());
+                m_map.pop_back();
+            }
+            m_first = m_size = 0;
+        }
+
+        // 释放备用块并收缩块指针表
+        void shrink_to_fit() {
+            if (m_spare) {
+                free_block(m_spare);
+                m_spare = nullptr;
+            }
+            m_map.shrink_to_fit();
+        }
+
+        iterator begin() {
+            return iterator(this, 0);
+        }
+
+        iterator end() {
+            return iterator(this, m_size);
+        }
+
+        const_iterator begin() const {
+            return const_iterator(this, 0);
+        }
+
+        const_iterator end() const {
+            return const_iterator(this, m_size);
+        }
+
+        size_t size() const noexcept {
+            return m_size;
+        }
+
+        bool empty() const noexcept {
+            return m_size == 0;
+        }
+
+        Alloc get_allocator() const {
+            return alloc();
+        }
+    };
+
+    template<typename T, typename Alloc>
+    bool operator==(const Deque<T, Alloc> &a, const Deque<T, Alloc> &b) {
+        if (a.size() != b.size()) return false;
+        for (size_t i = 0; i < a.size(); ++i) {
+            if (!(a[i] == b[i])) return false;
+        }
+        return true;
+    }
+
+    template<typename T, typename Alloc>
+    bool operator!=(const Deque<T, Alloc> &a, const Deque<T, Alloc> &b) {
+        return !(a == b);
+    }
+
+} // namespace stl
+
+#endif //STL_DEQUE_HPP
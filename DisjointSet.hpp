@@ -6,7 +6,7 @@
 #define STL_DISJOINTSET_HPP
 
 #include <vector>
-#include <unordered_map>
+#include "HashMap.hpp"
 
 namespace stl {
 
@@ -14,7 +14,7 @@ namespace stl {
     class DisjointSet {
     private:
         std::vector<size_t> m_parent; // 保存代表元素下标
-        std::unordered_map<T, size_t> m_data; // 保存元素以及初始下标
+        HashMap<T, size_t> m_data; // 保存元素以及初始下标
         size_t m_size;
 
     public:
@@ -23,15 +23,16 @@ namespace stl {
         ~DisjointSet() = default;
 
         // 查找几个元素所处集合
-        size_t find(T a) {
-            if (m_data.find(a) == m_data.end()) {
+        size_t find(const T &a) {
+            const auto iter = m_data.find(a);
+            if (iter == m_data.end()) {
                 return -1;
             }
-            size_t root = m_data[a];
+            size_t root = iter->second;
             while (root != m_parent[root]) {
                 root = m_parent[root];
             }
-            for (size_t i = m_data[a], temp; i != root; i = temp) {
+            for (size_t i = iter->second, temp; i != root; i = temp) {
                 temp = m_parent[i];
                 m_parent[i] = root;
             }
@@ -39,17 +40,22 @@ namespace stl {
         }
 
         // 插入集合元素
-        void insert(T a) {
-            if (m_data.find(a) != m_data.end()) {
+        void insert(const T &a) {
+            const auto result = m_data.try_emplace(a, m_parent.size());
+            if (!result.second) {
                 return;
             }
-            m_parent.push_back(m_parent.size());
-            m_data[a] = m_parent.back();
+            try {
+                m_parent.push_back(m_parent.size());
+            } catch (...) {
+                m_data.erase(result.first);
+                throw;
+            }
             ++m_size;
         }
 
         // 合并两个集合
-        void merge(T a, T b) {
+        void merge(const T &a, const T &b) {
             size_t pa = find(a), pb = find(b);
             if (pa == -1 || pb == -1) return;
             if (pa != pb) {
@@ -59,10 +65,11 @@ namespace stl {
         }
 
         // 将集合元素从所处集合中分离出来
-        void detach(T a) {
+        void detach(const T &a) {
             size_t pa = find(a);
             if (pa == -1) return;
-            m_parent[m_data[a]] = m_data[a];
+            const size_t i = m_data.find(a)->second;
+            m_parent[i] = i;
             ++m_size;
         }
 
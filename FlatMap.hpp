@@ -0,0 +1,477 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#ifndef STL_FLATMAP_HPP
+#define STL_FLATMAP_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "FlatSet.hpp"
+#include "Utility.hpp"
+#include "Vector.hpp"
+
+namespace stl {
+
+    namespace detail {
+        // 同时遍历键数组与值数组，解引用得到 pair<const K &, V &>
+        template<typename K, typename V, bool Const>
+        class FlatMapIterator {
+        private:
+            using value_ptr = std::conditional_t<Const, const V *, V *>;
+
+            const K *m_key;
+            value_ptr m_value;
+
+            template<typename, typename, bool> friend class FlatMapIterator;
+
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = std::pair<K, V>;
+            using difference_type = std::ptrdiff_t;
+            using reference = std::pair<const K &, std::conditional_t<Const, const V &, V &>>;
+
+            struct pointer {
+                reference ref;
+
+                reference *operator->() noexcept {
+                    return &ref;
+                }
+            };
+
+            FlatMapIterator() noexcept : m_key(nullptr), m_value(nullptr) {}
+
+            FlatMapIterator(const K *key, value_ptr value) noexcept : m_key(key), m_value(value) {}
+
+            template<bool C = Const, std::enable_if_t<C, int> = 0>
+            FlatMapIterator(const FlatMapIterator<K, V, false> &other) noexcept
+                    : m_key(other.m_key), m_value(other.m_value) {}
+
+            const K &key() const noexcept {
+                return *m_key;
+            }
+
+            auto &value() const noexcept {
+                return *m_value;
+            }
+
+            reference operator*() const noexcept {
+                return {*m_key, *m_value};
+            }
+
+            pointer operator->() const noexcept {
+                return {**this};
+            }
+
+            reference operator[](difference_type n) const noexcept {
+                return {m_key[n], m_value[n]};
+            }
+
+            FlatMapIterator &operator++() noexcept {
+                ++m_key;
+                ++m_value;
+                return *this;
+            }
+
+            FlatMapIterator operator++(int) noexcept {
+                FlatMapIterator temp = *this;
+                ++*this;
+                return temp;
+            }
+
+            FlatMapIterator &operator--() noexcept {
+                --m_key;
+                --m_value;
+                return *this;
+            }
+
+            FlatMapIterator operator--(int) noexcept {
+                FlatMapIterator temp = *this;
+                --*this;
+                return temp;
+            }
+
+            FlatMapIterator &operator+=(difference_type n) noexcept {
+                m_key += n;
+                m_value += n;
+                return *this;
+            }
+
+            FlatMapIterator &operator-=(difference_type n) noexcept {
+                return *this += -n;
+            }
+
+            friend FlatMapIterator operator+(FlatMapIterator iter, difference_type n) noexcept {
+                return iter += n;
+            }
+
+            friend FlatMapIterator operator+(difference_type n, FlatMapIterator iter) noexcept {
+                return iter += n;
+            }
+
+            friend FlatMapIterator operator-(FlatMapIterator iter, difference_type n) noexcept {
+                return iter -= n;
+            }
+
+            friend difference_type operator-(const FlatMapIterator &a, const FlatMapIterator &b) noexcept {
+                return a.m_key - b.m_key;
+            }
+
+            friend bool operator==(const FlatMapIterator &a, const FlatMapIterator &b) noexcept {
+                return a.m_key == b.m_key;
+            }
+
+            friend bool operator!=(const FlatMapIterator &a, const FlatMapIterator &b) noexcept {
+                return a.m_key != b.m_key;
+            }
+
+            friend bool operator<(const FlatMapIterator &a, const FlatMapIterator &b) noexcept {
+                return a.m_key < b.m_key;
+            }
+
+            friend bool operator>(const FlatMapIterator &a, const FlatMapIterator &b) noexcept {
+                return b < a;
+            }
+
+            friend bool operator<=(const FlatMapIterator &a, const FlatMapIterator &b) noexcept {
+                return !(b < a);
+            }
+
+            friend bool operator>=(const FlatMapIterator &a, const FlatMapIterator &b) noexcept {
+                return !(a < b);
+            }
+        };
+    } // namespace detail
+
+    // 有序 Vector 上的映射: 键和值分别保存在两个 Vector 中，二分查找只访问紧凑的键数组。
+    // 适合读多写少的配置表、路由表，单个插入删除为 O(n)，批量插入请用 insert_range
+    template<typename K, typename V, typename Compare = std::less<K>,
+            typename KeyAlloc = std::allocator<K>, typename ValueAlloc = std::allocator<V>>
+    class FlatMap {
+    private:
+        Vector<K, KeyAlloc> m_keys;
+        Vector<V, ValueAlloc> m_values;
+        Compare m_comp;
+
+        template<typename Key>
+        size_t lower_index(const Key &key) const {
+            return detail::branchless_lower_bound(m_keys.data(), m_keys.size(), key, m_comp);
+        }
+
+        template<typename Key>
+        size_t find_index(const Key &key) const {
+            const size_t i = lower_index(key);
+            return i < m_keys.size() && !m_comp(key, m_keys[i]) ? i : m_keys.size();
+        }
+
+        // 在位置 i 插入一对元素，值构造失败时撤销键的插入
+        template<typename Key, typename ...Args>
+        void insert_at(size_t i, Key &&key, Args &&... args) {
+            m_keys.emplace(m_keys.begin() + i, std::forward<Key>(key));
+            try {
+                m_values.emplace(m_values.begin() + i, std::forward<Args>(args)...);
+            } catch (...) {
+                m_keys.erase(m_keys.begin() + i);
+                throw;
+            }
+        }
+
+        // 按键排序并去重 (相等的键保留最先出现的)，再拆成键、值两个数组
+        template<typename InputIt>
+        void build(InputIt first, InputIt last, Vector<K, KeyAlloc> &keys, Vector<V, ValueAlloc> &values) const {
+            Vector<std::pair<K, V>> items;
+            items.append_range(first, last); // 输入可以是任意迭代器，不能直接用 last - first
+            std::stable_sort(items.begin(), items.end(), [this](const auto &a, const auto &b) {
+                return m_comp(a.first, b.first);
+            });
+            auto end = std::unique(items.begin(), items.end(), [this](const auto &a, const auto &b) {
+                return !m_comp(a.first, b.first) && !m_comp(b.first, a.first);
+            });
+            const size_t n = end - items.begin();
+            keys.reverse(n);
+            values.reverse(n);
+            for (size_t i = 0; i < n; ++i) {
+                keys.push_back(std::move(items[i].first));
+                values.push_back(std::move(items[i].second));
+            }
+        }
+
+    public:
+        using key_type = K;
+        using mapped_type = V;
+        using value_type = std::pair<K, V>;
+        using key_compare = Compare;
+        using iterator = detail::FlatMapIterator<K, V, false>;
+        using const_iterator = detail::FlatMapIterator<K, V, true>;
+
+        inline static const char *out_of_range = "flat map key not found";
+
+        FlatMap() = default;
+
+        explicit FlatMap(const Compare &comp, const KeyAlloc &key_alloc = KeyAlloc(),
+                         const ValueAlloc &value_alloc = ValueAlloc())
+                : m_keys(key_alloc), m_values(value_alloc), m_comp(comp) {}
+
+        // 无序输入只排序一次，重复的键保留最先出现的
+        template<typename InputIt, std::enable_if_t<is_iterator_v<InputIt>, int> = 0>
+        FlatMap(InputIt first, InputIt last, const Compare &comp = Compare(), const KeyAlloc &key_alloc = KeyAlloc(),
+                const ValueAlloc &value_alloc = ValueAlloc())
+                : FlatMap(comp, key_alloc, value_alloc) {
+            build(first, last, m_keys, m_values);
+        }
+
+        FlatMap(std::initializer_list<value_type> values, const Compare &comp = Compare())
+                : FlatMap(values.begin(), values.end(), comp) {}
+
+        // 接管已经按键有序且无重复的两个数组
+        FlatMap(sorted_unique_t, Vector<K, KeyAlloc> keys, Vector<V, ValueAlloc> values,
+                const Compare &comp = Compare())
+                : m_keys(std::move(keys)), m_values(std::move(values)), m_comp(comp) {
+            if (m_keys.size() != m_values.size()) {
+                throw std::invalid_argument("flat map keys and values differ in size");
+            }
+        }
+
+        iterator begin() {
+            return iterator(m_keys.data(), m_values.data());
+        }
+
+        iterator end() {
+            return begin() + m_keys.size();
+        }
+
+        const_iterator begin() const {
+            return const_iterator(m_keys.data(), m_values.data());
+        }
+
+        const_iterator end() const {
+            return begin() + m_keys.size();
+        }
+
+        size_t size() const noexcept {
+            return m_keys.size();
+        }
+
+        bool empty() const noexcept {
+            return m_keys.size() == 0;
+        }
+
+        void reserve(size_t n) {
+            m_keys.reverse(n);
+            m_values.reverse(n);
+        }
+
+        void shrink_to_fit() {
+            m_keys.shrink_to_fit();
+            m_values.shrink_to_fit();
+        }
+
+        void clear() {
+            m_keys.clear();
+            m_values.clear();
+        }
+
+        const Vector<K, KeyAlloc> &keys() const noexcept {
+            return m_keys;
+        }
+
+        const Vector<V, ValueAlloc> &values() const noexcept {
+            return m_values;
+        }
+
+        // 键不存在时才用 args 构造值
+        template<typename Key, typename ...Args,
+                std::enable_if_t<std::is_constructible_v<K, Key &&>, int> = 0>
+        std::pair<iterator, bool> try_emplace(Key &&key, Args &&... args) {
+            const size_t i = lower_index(key);
+            if (i < m_keys.size() && !m_comp(key, m_keys[i])) {
+                return {begin() + i, false};
+            }
+            insert_at(i, std::forward<Key>(key), std::forward<Args>(args)...);
+            return {begin() + i, true};
+        }
+
+        template<typename ...Args>
+        std::pair<iterator, bool> emplace(const K &key, Args &&... args) {
+            return try_emplace(key, std::forward<Args>(args)...);
+        }
+
+        template<typename ...Args>
+        std::pair<iterator, bool> emplace(K &&key, Args &&... args) {
+            return try_emplace(std::move(key), std::forward<Args>(args)...);
+        }
+
+        std::pair<iterator, bool> insert(const value_type &value) {
+            return try_emplace(value.first, value.second);
+        }
+
+        std::pair<iterator, bool> insert(value_type &&value) {
+            return try_emplace(std::move(value.first), std::move(value.second));
+        }
+
+        template<typename Key, typename Value>
+        std::pair<iterator, bool> insert_or_assign(Key &&key, Value &&value) {
+            auto result = try_emplace(std::forward<Key>(key), std::forward<Value>(value));
+            if (!result.second) {
+                result.first.value() = std::forward<Value>(value);
+            }
+            return result;
+        }
+
+        // 新元素排序去重后与已有元素归并，已存在的键保持原值；
+        // 归并为 O(n + m)，加上对 m 个新元素排序的 O(m log m)
+        template<typename InputIt, std::enable_if_t<is_iterator_v<InputIt>, int> = 0>
+        void insert_range(InputIt first, InputIt last) {
+            Vector<K, KeyAlloc> added_keys(m_keys.get_allocator());
+            Vector<V, ValueAlloc> added_values(m_values.get_allocator());
+            build(first, last, added_keys, added_values);
+            if (added_keys.empty()) return;
+
+            const size_t n = m_keys.size(), m = added_keys.size();
+            Vector<K, KeyAlloc> keys(m_keys.get_allocator());
+            Vector<V, ValueAlloc> values(m_values.get_allocator());
+            keys.reverse(n + m);
+            values.reverse(n + m);
+            size_t a = 0, b = 0;
+            while (a < n && b < m) {
+                if (m_comp(added_keys[b], m_keys[a])) {
+                    keys.push_back(std::move(added_keys[b]));
+                    values.push_back(std::move(added_values[b++]));
+                } else {
+                    if (!m_comp(m_keys[a], added_keys[b])) ++b; // 已存在
+                    keys.push_back(std::move(m_keys[a]));
+                    values.push_back(std::move(m_values[a++]));
+                }
+            }
+            for (; a < n; ++a) {
+                keys.push_back(std::move(m_keys[a]));
+                values.push_back(std::move(m_values[a]));
+            }
+            for (; b < m; ++b) {
+                keys.push_back(std::move(added_keys[b]));
+                values.push_back(std::move(added_values[b]));
+            }
+            m_keys = std::move(keys);
+            m_values = std::move(values);
+        }
+
+        void insert_range(std::initializer_list<value_type> values) {
+            insert_range(values.begin(), values.end());
+        }
+
+        V &operator[](const K &key) {
+            return try_emplace(key).first.value();
+        }
+
+        V &operator[](K &&key) {
+            return try_emplace(std::move(key)).first.value();
+        }
+
+        iterator erase(const_iterator iter) {
+            const size_t i = iter - begin();
+            m_keys.erase(m_keys.begin() + i);
+            m_values.erase(m_values.begin() + i);
+            return begin() + i;
+        }
+
+        iterator erase(const_iterator first, const_iterator last) {
+            const size_t i = first - begin(), j = last - begin();
+            m_keys.erase(m_keys.begin() + i, m_keys.begin() + j);
+            m_values.erase(m_values.begin() + i, m_values.begin() + j);
+            return begin() + i;
+        }
+
+        size_t erase(const K &key) {
+            const size_t i = find_index(key);
+            if (i == m_keys.size()) return 0;
+            erase(begin() + i);
+            return 1;
+        }
+
+        // 以下查找在 Compare 定义了 is_transparent 时接受任意可比较的类型
+        template<typename Key = K, std::enable_if_t<detail::lookup_arg_v<K, Compare, Key>, int> = 0>
+        iterator find(const Key &key) {
+            return begin() + find_index(detail::lookup_key<K, Compare>(key));
+        }
+
+        template<typename Key = K, std::enable_if_t<detail::lookup_arg_v<K, Compare, Key>, int> = 0>
+        const_iterator find(const Key &key) const {
+            return begin() + find_index(detail::lookup_key<K, Compare>(key));
+        }
+
+        template<typename Key = K, std::enable_if_t<detail::lookup_arg_v<K, Compare, Key>, int> = 0>
+        bool contains(const Key &key) const {
+            return find_index(detail::lookup_key<K, Compare>(key)) != m_keys.size();
+        }
+
+        template<typename Key = K, std::enable_if_t<detail::lookup_arg_v<K, Compare, Key>, int> = 0>
+        size_t count(const Key &key) const {
+            return contains(key);
+        }
+
+        template<typename Key = K, std::enable_if_t<detail::lookup_arg_v<K, Compare, Key>, int> = 0>
+        V &at(const Key &key) {
+            return const_cast<V &>(static_cast<const FlatMap &>(*this).at(key));
+        }
+
+        template<typename Key = K, std::enable_if_t<detail::lookup_arg_v<K, Compare, Key>, int> = 0>
+        const V &at(const Key &key) const {
+            const size_t i = find_index(detail::lookup_key<K, Compare>(key));
+            if (i == m_keys.size()) {
+                throw std::out_of_range(out_of_range);
+            }
+            return m_values[i];
+        }
+
+        template<typename Key = K, std::enable_if_t<detail::lookup_arg_v<K, Compare, Key>, int> = 0>
+        iterator lower_bound(const Key &key) {
+            return begin() + lower_index(detail::lookup_key<K, Compare>(key));
+        }
+
+        template<typename Key = K, std::enable_if_t<detail::lookup_arg_v<K, Compare, Key>, int> = 0>
+        const_iterator lower_bound(const Key &key) const {
+            return begin() + lower_index(detail::lookup_key<K, Compare>(key));
+        }
+
+        template<typename Key = K, std::enable_if_t<detail::lookup_arg_v<K, Compare, Key>, int> = 0>
+        iterator upper_bound(const Key &key) {
+            return begin() + detail::branchless_upper_bound(m_keys.data(), m_keys.size(),
+                                                            detail::lookup_key<K, Compare>(key), m_comp);
+        }
+
+        template<typename Key = K, std::enable_if_t<detail::lookup_arg_v<K, Compare, Key>, int> = 0>
+        const_iterator upper_bound(const Key &key) const {
+            return begin() + detail::branchless_upper_bound(m_keys.data(), m_keys.size(),
+                                                            detail::lookup_key<K, Compare>(key), m_comp);
+        }
+
+        key_compare key_comp() const {
+            return m_comp;
+        }
+
+        void swap(FlatMap &other) noexcept {
+            using std::swap;
+            m_keys.swap(other.m_keys);
+            m_values.swap(other.m_values);
+            swap(m_comp, other.m_comp);
+        }
+
+        friend bool operator==(const FlatMap &a, const FlatMap &b) {
+            return a.m_keys == b.m_keys && a.m_values == b.m_values;
+        }
+
+        friend bool operator!=(const FlatMap &a, const FlatMap &b) {
+            return !(a == b);
+        }
+    };
+
+} // namespace stl
+
+#endif //STL_FLATMAP_HPP
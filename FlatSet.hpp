@@ -0,0 +1,265 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#ifndef STL_FLATSET_HPP
+#define STL_FLATSET_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+#include "Utility.hpp"
+#include "Vector.hpp"
+
+namespace stl {
+
+    // 构造时表明输入已经有序且没有重复，跳过排序
+    struct sorted_unique_t {
+        explicit sorted_unique_t() = default;
+    };
+
+    inline constexpr sorted_unique_t sorted_unique{};
+
+    namespace detail {
+        // 无分支的二分查找: 每轮只做一次比较，用条件移动代替跳转，循环次数只取决于 n。
+        // 返回第一个不小于 key 的位置
+        template<typename T, typename Key, typename Compare>
+        size_t branchless_lower_bound(const T *data, size_t n, const Key &key, const Compare &comp) {
+            if (n == 0) return 0;
+            const T *base = data;
+            while (n > 1) {
+                const size_t half = n / 2;
+                base = comp(base[half], key) ? base + half : base;
+                n -= half;
+            }
+            return static_cast<size_t>(base - data) + comp(*base, key);
+        }
+
+        // 返回第一个大于 key 的位置
+        template<typename T, typename Key, typename Compare>
+        size_t branchless_upper_bound(const T *data, size_t n, const Key &key, const Compare &comp) {
+            if (n == 0) return 0;
+            const T *base = data;
+            while (n > 1) {
+                const size_t half = n / 2;
+                base = comp(key, base[half]) ? base : base + half;
+                n -= half;
+            }
+            return static_cast<size_t>(base - data) + !comp(key, *base);
+        }
+    } // namespace detail
+
+    // 有序 Vector 上的集合: 查找为二分查找，内存紧凑、遍历连续；插入删除需要搬动元素，
+    // 适合读多写少的场合。批量构造与 insert_range 只排序一次，避免逐个插入的 O(n^2)
+    template<typename K, typename Compare = std::less<K>, typename Alloc = std::allocator<K>>
+    class FlatSet {
+    private:
+        Vector<K, Alloc> m_keys;
+        Compare m_comp;
+
+        bool equivalent(const K &a, const K &b) const {
+            return !m_comp(a, b) && !m_comp(b, a);
+        }
+
+        // 排序并去重，相等的元素保留最先出现的
+        void sort_unique() {
+            std::stable_sort(m_keys.begin(), m_keys.end(), m_comp);
+            auto last = std::unique(m_keys.begin(), m_keys.end(), [this](const K &a, const K &b) {
+                return equivalent(a, b);
+            });
+            m_keys.erase(last, m_keys.end());
+        }
+
+        template<typename Key>
+        size_t lower_index(const Key &key) const {
+            return detail::branchless_lower_bound(m_keys.data(), m_keys.size(), key, m_comp);
+        }
+
+        template<typename Key>
+        size_t find_index(const Key &key) const {
+            const size_t i = lower_index(key);
+            return i < m_keys.size() && !m_comp(key, m_keys[i]) ? i : m_keys.size();
+        }
+
+    public:
+        using key_type = K;
+        using value_type = K;
+        using key_compare = Compare;
+        using allocator_type = Alloc;
+        using iterator = const K *;
+        using const_iterator = const K *;
+
+        FlatSet() = default;
+
+        explicit FlatSet(const Compare &comp, const Alloc &alloc = Alloc()) : m_keys(alloc), m_comp(comp) {}
+
+        template<typename InputIt, std::enable_if_t<is_iterator_v<InputIt>, int> = 0>
+        FlatSet(InputIt first, InputIt last, const Compare &comp = Compare(), const Alloc &alloc = Alloc())
+                : m_keys(alloc), m_comp(comp) {
+            m_keys.append_range(first, last); // 输入可以是任意迭代器，不能直接用 last - first
+            sort_unique();
+        }
+
+        FlatSet(std::initializer_list<K> keys, const Compare &comp = Compare(), const Alloc &alloc = Alloc())
+                : FlatSet(keys.begin(), keys.end(), comp, alloc) {}
+
+        // 接管已经有序且无重复的 keys
+        FlatSet(sorted_unique_t, Vector<K, Alloc> keys, const Compare &comp = Compare())
+                : m_keys(std::move(keys)), m_comp(comp) {}
+
+        iterator begin() const {
+            return m_keys.data();
+        }
+
+        iterator end() const {
+            return m_keys.data() + m_keys.size();
+        }
+
+        size_t size() const noexcept {
+            return m_keys.size();
+        }
+
+        bool empty() const noexcept {
+            return m_keys.size() == 0;
+        }
+
+        void reserve(size_t n) {
+            m_keys.reverse(n);
+        }
+
+        void shrink_to_fit() {
+            m_keys.shrink_to_fit();
+        }
+
+        void clear() {
+            m_keys.clear();
+        }
+
+        // 有序的底层存储
+        const Vector<K, Alloc> &keys() const noexcept {
+            return m_keys;
+        }
+
+        // 交出底层存储，之后集合为空
+        Vector<K, Alloc> extract() && {
+            return std::move(m_keys);
+        }
+
+        // 返回元素的位置以及是否插入了新元素
+        template<typename ...Args>
+        std::pair<iterator, bool> emplace(Args &&... args) {
+            K key(std::forward<Args>(args)...);
+            const size_t i = lower_index(key);
+            if (i < m_keys.size() && !m_comp(key, m_keys[i])) {
+                return {begin() + i, false};
+            }
+            m_keys.insert(m_keys.begin() + i, std::move(key));
+            return {begin() + i, true};
+        }
+
+        std::pair<iterator, bool> insert(const K &key) {
+            return emplace(key);
+        }
+
+        std::pair<iterator, bool> insert(K &&key) {
+            return emplace(std::move(key));
+        }
+
+        // 排序新元素后与已有元素归并，已存在的元素保持不变；
+        // 归并为 O(n + m)，加上对 m 个新元素排序的 O(m log m)
+        template<typename InputIt, std::enable_if_t<is_iterator_v<InputIt>, int> = 0>
+        void insert_range(InputIt first, InputIt last) {
+            FlatSet added(first, last, m_comp, m_keys.get_allocator());
+            if (added.empty()) return;
+            Vector<K, Alloc> merged(m_keys.get_allocator());
+            merged.reverse(m_keys.size() + added.size());
+            K *a = m_keys.data(), *a_end = a + m_keys.size();
+            K *b = added.m_keys.data(), *b_end = b + added.size();
+            while (a != a_end && b != b_end) {
+                if (m_comp(*b, *a)) {
+                    merged.push_back(std::move(*b++));
+                } else {
+                    if (!m_comp(*a, *b)) ++b; // 已存在
+                    merged.push_back(std::move(*a++));
+                }
+            }
+            for (; a != a_end; ++a) merged.push_back(std::move(*a));
+            for (; b != b_end; ++b) merged.push_back(std::move(*b));
+            m_keys = std::move(merged);
+        }
+
+        void insert_range(std::initializer_list<K> keys) {
+            insert_range(keys.begin(), keys.end());
+        }
+
+        iterator erase(const_iterator iter) {
+            const size_t i = iter - begin();
+            m_keys.erase(m_keys.begin() + i);
+            return begin() + i;
+        }
+
+        iterator erase(const_iterator first, const_iterator last) {
+            const size_t i = first - begin();
+            m_keys.erase(m_keys.begin() + i, m_keys.begin() + (last - begin()));
+            return begin() + i;
+        }
+
+        size_t erase(const K &key) {
+            const size_t i = find_index(key);
+            if (i == m_keys.size()) return 0;
+            m_keys.erase(m_keys.begin() + i);
+            return 1;
+        }
+
+        // 以下查找在 Compare 定义了 is_transparent 时接受任意可比较的类型
+        template<typename Key = K, std::enable_if_t<detail::lookup_arg_v<K, Compare, Key>, int> = 0>
+        iterator find(const Key &key) const {
+            return begin() + find_index(detail::lookup_key<K, Compare>(key));
+        }
+
+        template<typename Key = K, std::enable_if_t<detail::lookup_arg_v<K, Compare, Key>, int> = 0>
+        bool contains(const Key &key) const {
+            return find_index(detail::lookup_key<K, Compare>(key)) != m_keys.size();
+        }
+
+        template<typename Key = K, std::enable_if_t<detail::lookup_arg_v<K, Compare, Key>, int> = 0>
+        size_t count(const Key &key) const {
+            return contains(key);
+        }
+
+        template<typename Key = K, std::enable_if_t<detail::lookup_arg_v<K, Compare, Key>, int> = 0>
+        iterator lower_bound(const Key &key) const {
+            return begin() + lower_index(detail::lookup_key<K, Compare>(key));
+        }
+
+        template<typename Key = K, std::enable_if_t<detail::lookup_arg_v<K, Compare, Key>, int> = 0>
+        iterator upper_bound(const Key &key) const {
+            return begin() + detail::branchless_upper_bound(m_keys.data(), m_keys.size(),
+                                                            detail::lookup_key<K, Compare>(key), m_comp);
+        }
+
+        key_compare key_comp() const {
+            return m_comp;
+        }
+
+        void swap(FlatSet &other) noexcept {
+            using std::swap;
+            m_keys.swap(other.m_keys);
+            swap(m_comp, other.m_comp);
+        }
+
+        friend bool operator==(const FlatSet &a, const FlatSet &b) {
+            return a.m_keys == b.m_keys;
+        }
+
+        friend bool operator!=(const FlatSet &a, const FlatSet &b) {
+            return !(a == b);
+        }
+    };
+
+} // namespace stl
+
+#endif //STL_FLATSET_HPP
@@ -0,0 +1,333 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#ifndef STL_FORMAT_HPP
+#define STL_FORMAT_HPP
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include "String.h"
+#include "StringView.hpp"
+
+// 类型安全的格式化，结果直接追加到 String 中:
+//     stl::format_to(line, STL_FORMAT("{} {} took {} ms"), method, path, elapsed);
+//     stl::String text = stl::format(STL_FORMAT("id={}"), id);
+// 格式串中只有 {} 一种占位符，{{ 和 }} 表示字面的大括号。STL_FORMAT 包装的格式串在编译期解析，
+// 占位符与参数个数不一致或大括号不配对时编译失败；也可以直接传入运行期的字符串，此时出错抛出 std::invalid_argument。
+//
+// 整数用两位一组的查表转换，浮点数输出能精确还原的最短表示 (与 std::to_chars 相同，libstdc++ 与 MSVC 的实现基于 Ryu)。
+// 自定义类型可以特化 Formatter:
+//     template<>
+//     struct stl::Formatter<Point> {
+//         static void format(stl::String &out, const Point &p) { stl::format_to(out, STL_FORMAT("({}, {})"), p.x, p.y); }
+//     };
+#define STL_FORMAT(str)                                                                                       \
+    ([] {                                                                                                     \
+        struct FormatString : ::stl::detail::FormatStringBase {                                               \
+            static constexpr const char *data() { return str; }                                              \
+            static constexpr size_t size() { return sizeof(str) - 1; }                                       \
+        };                                                                                                    \
+        return FormatString{};                                                                                \
+    }())
+
+namespace stl {
+
+    namespace detail {
+        struct FormatStringBase {};
+
+        template<typename S>
+        inline constexpr bool is_format_string_v = std::is_base_of_v<FormatStringBase, S>;
+
+        inline constexpr size_t format_error = size_t(-1);
+
+        // 占位符的个数，大括号不配对时返回 format_error
+        constexpr size_t count_placeholders(const char *str, size_t n) {
+            size_t count = 0;
+            for (size_t i = 0; i < n; ++i) {
+                if (str[i] != '{' && str[i] != '}') continue;
+                if (i + 1 < n && str[i + 1] == str[i]) { // {{ 或 }}
+                    ++i;
+                } else if (str[i] == '{' && i + 1 < n && str[i + 1] == '}') {
+                    ++i;
+                    ++count;
+                } else {
+                    return format_error;
+                }
+            }
+            return count;
+        }
+
+        // 去掉转义后的字面文字，第 i 段位于 [bounds[i], bounds[i + 1])，段与段之间是第 i 个参数
+        template<size_t N, size_t Args>
+        struct FormatPlan {
+            char text[N + 1] = {};
+            size_t bounds[Args + 2] = {};
+        };
+
+        template<size_t N, size_t Args>
+        constexpr FormatPlan<N, Args> make_plan(const char *str) {
+            FormatPlan<N, Args> plan{};
+            size_t length = 0, arg = 0;
+            for (size_t i = 0; i < N; ++i) {
+                if (str[i] == '{' && str[i + 1] == '}') {
+                    plan.bounds[++arg] = length;
+                    ++i;
+                    continue;
+                }
+                plan.text[length++] = str[i];
+                if (str[i] == '{' || str[i] == '}') ++i;
+            }
+            plan.bounds[Args + 1] = length;
+            return plan;
+        }
+
+        inline void append_literal(String &out, const char *str, size_t n) {
+            if (n) out.append(str, n);
+        }
+
+        // 把 fmt 从 pos 开始、下一个 {} 之前的文字追加到 out，返回 {} 之后的位置；到达末尾时返回 format_error
+        inline size_t format_literal(String &out, StringView fmt, size_t pos) {
+            while (pos < fmt.size()) {
+                const size_t brace = fmt.find_first_of(StringView("{}", 2), pos);
+                if (brace == StringView::npos) {
+                    append_literal(out, fmt.data() + pos, fmt.size() - pos);
+                    break;
+                }
+                append_literal(out, fmt.data() + pos, brace - pos);
+                if (brace + 1 < fmt.size() && fmt[brace + 1] == fmt[brace]) {
+                    out.push_back(fmt[brace]);
+                    pos = brace + 2;
+                } else if (fmt[brace] == '{' && brace + 1 < fmt.size() && fmt[brace + 1] == '}') {
+                    return brace + 2;
+                } else {
+                    throw std::invalid_argument("unmatched brace in format string");
+                }
+            }
+            return format_error;
+        }
+
+        inline constexpr char digit_pairs[] =
+                "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+                "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+                "8081828384858687888990919293949596979899";
+
+        inline constexpr uint64_t powers_of_10[] = {
+                1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL,
+                1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+                100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+                1000000000000000000ULL, 10000000000000000000ULL};
+
+        // 十进制位数: 先由二进制位数估计 (乘以 log10(2) ≈ 1233 / 4096)，再与 10 的幂比较一次修正
+        inline size_t count_digits(uint64_t value) noexcept {
+            if (value < 10) return 1;
+            const size_t bits = 64 - __builtin_clzll(value);
+            const size_t t = bits * 1233 >> 12;
+            return t + (value >= powers_of_10[t]);
+        }
+
+        // 从 end 向前写入 value 的十进制表示，每次处理两位
+        inline void write_decimal(char *end, uint64_t value) noexcept {
+            while (value >= 100) {
+                const size_t i = static_cast<size_t>(value % 100) * 2;
+                value /= 100;
+                end -= 2;
+                std::memcpy(end, digit_pairs + i, 2);
+            }
+            if (value >= 10) {
+                std::memcpy(end - 2, digit_pairs + value * 2, 2);
+            } else {
+                end[-1] = static_cast<char>('0' + value);
+            }
+        }
+
+        // 位数确定后直接写入 out 的缓冲区
+        template<typename T>
+        void format_integer(String &out, T value) {
+            static_assert(sizeof(T) <= sizeof(uint64_t), "integer type is too wide");
+            uint64_t magnitude = static_cast<std::make_unsigned_t<T>>(value);
+            bool negative = false;
+            if constexpr (std::is_signed_v<T>) {
+                if (value < 0) {
+                    negative = true;
+                    magnitude = 0 - static_cast<uint64_t>(static_cast<int64_t>(value));
+                }
+            }
+            const size_t digits = count_digits(magnitude);
+            char *p = out.grow_by(digits + negative);
+            if (negative) *p++ = '-';
+            write_decimal(p + digits, magnitude);
+        }
+
+        inline void format_hex(String &out, uint64_t value) {
+            const size_t digits = value ? (64 - __builtin_clzll(value) + 3) / 4 : 1;
+            char *end = out.grow_by(digits) + digits;
+            for (size_t i = 0; i < digits; ++i, value >>= 4) {
+                *--end = "0123456789abcdef"[value & 0xf];
+            }
+        }
+
+        template<typename T>
+        void format_float(String &out, T value) {
+            char buffer[32];
+#if defined(__cpp_lib_to_chars)
+            const std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            out.append(buffer, static_cast<size_t>(result.ptr - buffer));
+#else
+            // 标准库不支持浮点数 to_chars 时，依次尝试 digits10 与 max_digits10 位精度，取第一个能还原的
+            int n = 0;
+            for (const int precision : {std::numeric_limits<T>::digits10, std::numeric_limits<T>::max_digits10}) {
+                n = std::snprintf(buffer, sizeof(buffer), "%.*g", precision, static_cast<double>(value));
+                if (static_cast<T>(std::strtod(buffer, nullptr)) == value) break;
+            }
+            out.append(buffer, static_cast<size_t>(n));
+#endif
+        }
+
+        template<typename T>
+        inline constexpr bool is_char_v = std::is_same_v<T, char> || std::is_same_v<T, wchar_t> ||
+                                          std::is_same_v<T, char16_t> || std::is_same_v<T, char32_t>;
+    } // namespace detail
+
+    // 按十六进制 (小写、不带前缀) 输出整数: format(STL_FORMAT("{}"), hex(flags))
+    template<typename T>
+    struct Hex {
+        T value;
+    };
+
+    template<typename T>
+    Hex<T> hex(T value) noexcept {
+        static_assert(std::is_integral_v<T>, "hex requires an integral type");
+        return Hex<T>{value};
+    }
+
+    // 参数类型到文本的转换，没有特化的类型不能作为格式化参数
+    template<typename T, typename = void>
+    struct Formatter;
+
+    template<typename T>
+    struct Formatter<T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool> && !detail::is_char_v<T>>> {
+        static void format(String &out, T value) {
+            detail::format_integer(out, value);
+        }
+    };
+
+    template<typename T>
+    struct Formatter<T, std::enable_if_t<std::is_floating_point_v<T>>> {
+        static void format(String &out, T value) {
+            if constexpr (std::is_same_v<T, long double>) {
+                detail::format_float(out, static_cast<double>(value));
+            } else {
+                detail::format_float(out, value);
+            }
+        }
+    };
+
+    template<>
+    struct Formatter<bool> {
+        static void format(String &out, bool value) {
+            value ? out.append("true", 4) : out.append("false", 5);
+        }
+    };
+
+    template<>
+    struct Formatter<char> {
+        static void format(String &out, char value) {
+            out.push_back(value);
+        }
+    };
+
+    // char 指针按 C 字符串输出，其余指针输出地址
+    template<typename T>
+    struct Formatter<T *> {
+        static void format(String &out, const T *value) {
+            if constexpr (std::is_same_v<std::remove_cv_t<T>, char>) {
+                if (value == nullptr) {
+                    out.append("(null)", 6);
+                } else {
+                    out.append(value, std::strlen(value));
+                }
+            } else {
+                out.append("0x", 2);
+                detail::format_hex(out, reinterpret_cast<uintptr_t>(value));
+            }
+        }
+    };
+
+    template<typename T>
+    struct Formatter<T, std::enable_if_t<!std::is_pointer_v<T> && std::is_convertible_v<const T &, StringView>>> {
+        static void format(String &out, const T &value) {
+            const StringView str = value;
+            detail::append_literal(out, str.data(), str.size());
+        }
+    };
+
+    template<typename T>
+    struct Formatter<T, std::enable_if_t<!std::is_pointer_v<T> && !std::is_convertible_v<const T &, StringView> &&
+                                         std::is_convertible_v<const T &, std::string_view>>> {
+        static void format(String &out, const T &value) {
+            const std::string_view str = value;
+            detail::append_literal(out, str.data(), str.size());
+        }
+    };
+
+    template<typename T>
+    struct Formatter<Hex<T>> {
+        static void format(String &out, Hex<T> value) {
+            detail::format_hex(out, static_cast<std::make_unsigned_t<T>>(value.value));
+        }
+    };
+
+    // 编译期格式串，见 STL_FORMAT
+    template<typename S, typename... Args, std::enable_if_t<detail::is_format_string_v<S>, int> = 0>
+    void format_to(String &out, S, const Args &...args) {
+        constexpr size_t count = detail::count_placeholders(S::data(), S::size());
+        static_assert(count != detail::format_error, "unmatched brace in format string");
+        static_assert(count == detail::format_error || count == sizeof...(Args),
+                      "number of arguments does not match the {} in format string");
+        static constexpr auto plan =
+                detail::make_plan<S::size(), count == detail::format_error ? 0 : count>(S::data());
+        [[maybe_unused]] size_t i = 0;
+        detail::append_literal(out, plan.text, plan.bounds[1]);
+        ((Formatter<std::decay_t<Args>>::format(out, args), ++i,
+          detail::append_literal(out, plan.text + plan.bounds[i], plan.bounds[i + 1] - plan.bounds[i])), ...);
+    }
+
+    // 运行期格式串，每次调用都重新解析
+    template<typename... Args>
+    void format_to(String &out, StringView fmt, const Args &...args) {
+        size_t pos = 0;
+        [[maybe_unused]] auto format_arg = [&](const auto &arg) {
+            if (pos != detail::format_error) {
+                pos = detail::format_literal(out, fmt, pos);
+            }
+            if (pos == detail::format_error) {
+                throw std::invalid_argument("too many arguments for format string");
+            }
+            Formatter<std::decay_t<decltype(arg)>>::format(out, arg);
+        };
+        (format_arg(args), ...);
+        if (pos != detail::format_error && detail::format_literal(out, fmt, pos) != detail::format_error) {
+            throw std::invalid_argument("too few arguments for format string");
+        }
+    }
+
+    template<typename F, typename... Args>
+    String format(const F &fmt, const Args &...args) {
+        String out;
+        format_to(out, fmt, args...);
+        return out;
+    }
+
+} // namespace stl
+
+#endif //STL_FORMAT_HPP
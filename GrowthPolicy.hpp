@@ -0,0 +1,73 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#ifndef STL_GROWTHPOLICY_HPP
+#define STL_GROWTHPOLICY_HPP
+
+#include <algorithm>
+#include <cstddef>
+
+namespace stl {
+
+    // 扩容策略:
+    //     grow(capacity, need, elem_size) 容量不足以容纳 need 个元素时返回新的容量 (>= need)
+    //     fit(n, elem_size)                显式 reverse(n) 时实际申请的容量 (>= n)
+
+    // 扩容到原来的 2 倍
+    struct DoublingGrowth {
+        static size_t grow(size_t capacity, size_t need, size_t) noexcept {
+            size_t new_capacity = capacity ? capacity : 1;
+            while (new_capacity < need) {
+                new_capacity <<= 1ULL;
+            }
+            return new_capacity;
+        }
+
+        static size_t fit(size_t n, size_t) noexcept {
+            return n;
+        }
+    };
+
+    // 扩容到原来的 1.5 倍，释放的旧内存之和有机会被后续的扩容复用
+    struct HalfGrowth {
+        static size_t grow(size_t capacity, size_t need, size_t) noexcept {
+            size_t new_capacity = capacity ? capacity : 1;
+            while (new_capacity < need) {
+                new_capacity = (new_capacity << 1ULL) - (new_capacity >> 1ULL);
+            }
+            return new_capacity;
+        }
+
+        static size_t fit(size_t n, size_t) noexcept {
+            return n;
+        }
+    };
+
+    // 把字节数向上取整到常见 malloc 实现 (jemalloc/tcmalloc) 的大小等级:
+    // 128 字节以内按 16 字节对齐，之后每个 2 的幂区间均分为 4 级，超过 2 MiB 按页对齐
+    inline size_t malloc_size_class(size_t bytes) noexcept {
+        constexpr size_t page = 4096, huge = size_t(2) << 20;
+        if (bytes <= 16) return bytes <= 8 ? 8 : 16;
+        if (bytes <= 128) return (bytes + 15) & ~size_t(15);
+        if (bytes >= huge) return (bytes + page - 1) & ~(page - 1);
+        size_t group = size_t(1) << (63 - __builtin_clzll(bytes - 1)); // 小于 bytes 的最大 2 的幂
+        const size_t spacing = group >> 2;
+        return (bytes + spacing - 1) & ~(spacing - 1);
+    }
+
+    // 按 1.5 倍扩容，再把容量补齐到分配器实际给出的大小等级，避免内部碎片
+    struct SizeClassGrowth {
+        static size_t grow(size_t capacity, size_t need, size_t elem_size) noexcept {
+            return fit(std::max(need, capacity + (capacity >> 1ULL)), elem_size);
+        }
+
+        static size_t fit(size_t n, size_t elem_size) noexcept {
+            if (n == 0) return 0;
+            return malloc_size_class(n * elem_size) / elem_size;
+        }
+    };
+
+} // namespace stl
+
+#endif //STL_GROWTHPOLICY_HPP
@@ -0,0 +1,101 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#ifndef STL_HASH_HPP
+#define STL_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace stl {
+
+    namespace detail {
+        inline constexpr uint64_t hash_k0 = 0xa0761d6478bd642fULL;
+        inline constexpr uint64_t hash_k1 = 0xe7037ed1a0b428dbULL;
+        inline constexpr uint64_t hash_k2 = 0x8ebc6af09c88c6e3ULL;
+
+        inline uint64_t read64(const unsigned char *p) noexcept {
+            uint64_t v;
+            std::memcpy(&v, p, sizeof(v));
+            return v;
+        }
+
+        inline uint64_t read32(const unsigned char *p) noexcept {
+            uint32_t v;
+            std::memcpy(&v, p, sizeof(v));
+            return v;
+        }
+    } // namespace detail
+
+    // 64 位乘法后折叠高低两半，乘积的每一位都会影响结果
+    inline uint64_t hash_mix(uint64_t a, uint64_t b) noexcept {
+#if defined(__SIZEOF_INT128__)
+        const __uint128_t r = static_cast<__uint128_t>(a) * b;
+        return static_cast<uint64_t>(r) ^ static_cast<uint64_t>(r >> 64);
+#else
+        const uint64_t lo = a * b;
+        const uint64_t hi = (a >> 32) * (b >> 32) + ((a >> 32) * (b & 0xffffffff) >> 32) +
+                            ((a & 0xffffffff) * (b >> 32) >> 32);
+        return lo ^ hi;
+#endif
+    }
+
+    // 整数的散列: std::hash 对整数是恒等映射，直接用于开放寻址表会在连续的键上产生聚集
+    inline uint64_t hash_int(uint64_t value) noexcept {
+        return hash_mix(value ^ detail::hash_k0, detail::hash_k1);
+    }
+
+    // 字节串的散列: 每次读取 16 字节，尾部用可能重叠的两次读取补齐，不逐字节处理
+    inline uint64_t hash_bytes(const void *data, size_t n, uint64_t seed = 0) noexcept {
+        const auto *p = static_cast<const unsigned char *>(data);
+        uint64_t h = seed ^ hash_mix(seed ^ detail::hash_k0, detail::hash_k1);
+        uint64_t a = 0, b = 0;
+        if (n <= 16) {
+            if (n >= 4) {
+                const size_t mid = (n >> 3) << 2;
+                a = detail::read32(p) << 32 | detail::read32(p + mid);
+                b = detail::read32(p + n - 4) << 32 | detail::read32(p + n - 4 - mid);
+            } else if (n > 0) {
+                a = static_cast<uint64_t>(p[0]) << 16 | static_cast<uint64_t>(p[n >> 1]) << 8 | p[n - 1];
+            }
+        } else {
+            size_t i = n;
+            for (; i > 16; i -= 16, p += 16) {
+                h = hash_mix(detail::read64(p) ^ detail::hash_k1, detail::read64(p + 8) ^ h);
+            }
+            a = detail::read64(p + i - 16);
+            b = detail::read64(p + i - 8);
+        }
+        return hash_mix(detail::hash_k1 ^ n, hash_mix(a ^ detail::hash_k1, b ^ h) ^ detail::hash_k2);
+    }
+
+    // 容器默认的散列函数: 在 std::hash 的结果上再做一次混合。
+    // 自定义类型可以特化 std::hash，或者直接特化该模板
+    template<typename T>
+    struct Hash {
+        size_t operator()(const T &value) const noexcept(noexcept(std::hash<T>{}(value))) {
+            return static_cast<size_t>(hash_int(std::hash<T>{}(value)));
+        }
+    };
+
+    // 字符串按内容散列；is_transparent 允许用其他字符串类型直接查找
+    template<>
+    struct Hash<std::string_view> {
+        using is_transparent = void;
+
+        size_t operator()(std::string_view str) const noexcept {
+            return static_cast<size_t>(hash_bytes(str.data(), str.size()));
+        }
+    };
+
+    template<>
+    struct Hash<std::string> : Hash<std::string_view> {};
+
+} // namespace stl
+
+#endif //STL_HASH_HPP
@@ -0,0 +1,256 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#ifndef STL_HASHMAP_HPP
+#define STL_HASHMAP_HPP
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "Hash.hpp"
+#include "HashTable.hpp"
+#include "Utility.hpp"
+
+namespace stl {
+
+    // 开放寻址的散列映射，键值对直接存放在槽位数组中，不为每个元素单独分配内存。
+    // 插入可能使迭代器和引用失效 (扩容时)，删除不会移动其他元素。
+    // Hash 定义了 is_transparent 时可以用其他类型查找，例如 HashMap<String, V> 直接用 const char * 查找
+    template<typename K, typename V, typename Hash = stl::Hash<K>, typename KeyEqual = std::equal_to<>,
+            typename Alloc = std::allocator<std::pair<const K, V>>>
+    class HashMap {
+    private:
+        using table_type = detail::HashTable<detail::MapPolicy<K, V>, Hash, KeyEqual, Alloc>;
+
+        table_type m_table;
+
+    public:
+        using key_type = K;
+        using mapped_type = V;
+        using value_type = std::pair<const K, V>;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+        using allocator_type = Alloc;
+        using iterator = typename table_type::iterator;
+        using const_iterator = typename table_type::const_iterator;
+
+        inline static const char *out_of_range = "hash map key not found";
+
+        HashMap() = default;
+
+        // 预留 n 个元素的空间
+        explicit HashMap(size_t n, const Hash &hash = Hash(), const KeyEqual &eq = KeyEqual(),
+                         const Alloc &alloc = Alloc())
+                : m_table(n, hash, eq, alloc) {}
+
+        // 重复的键保留最先出现的
+        template<typename InputIt, std::enable_if_t<is_iterator_v<InputIt>, int> = 0>
+        HashMap(InputIt first, InputIt last, size_t n = 0, const Hash &hash = Hash(), const KeyEqual &eq = KeyEqual(),
+                const Alloc &alloc = Alloc())
+                : m_table(n, hash, eq, alloc) {
+            insert(first, last);
+        }
+
+        HashMap(std::initializer_list<value_type> values, size_t n = 0, const Hash &hash = Hash(),
+                const KeyEqual &eq = KeyEqual(), const Alloc &alloc = Alloc())
+                : HashMap(values.begin(), values.end(), n ? n : values.size(), hash, eq, alloc) {}
+
+        iterator begin() noexcept {
+            return m_table.begin();
+        }
+
+        iterator end() noexcept {
+            return m_table.end();
+        }
+
+        const_iterator begin() const noexcept {
+            return m_table.begin();
+        }
+
+        const_iterator end() const noexcept {
+            return m_table.end();
+        }
+
+        size_t size() const noexcept {
+            return m_table.size();
+        }
+
+        bool empty() const noexcept {
+            return m_table.size() == 0;
+        }
+
+        size_t capacity() const noexcept {
+            return m_table.capacity();
+        }
+
+        double load_factor() const noexcept {
+            return capacity() ? static_cast<double>(size()) / static_cast<double>(capacity()) : 0.0;
+        }
+
+        // 保证容纳 n 个元素之前不再扩容
+        void reserve(size_t n) {
+            m_table.reserve(n);
+        }
+
+        void shrink_to_fit() {
+            m_table.shrink_to_fit();
+        }
+
+        // 保留已分配的内存
+        void clear() noexcept {
+            m_table.clear();
+        }
+
+        // 键不存在时才用 args 构造值。不能直接查找的键类型先转换为 K
+        template<typename Key, typename ...Args, std::enable_if_t<std::is_constructible_v<K, Key &&>, int> = 0>
+        std::pair<iterator, bool> try_emplace(Key &&key, Args &&... args) {
+            if constexpr (detail::direct_lookup_v<K, Hash, std::decay_t<Key>>) {
+                const auto result = m_table.emplace(key, std::piecewise_construct,
+                                                    std::forward_as_tuple(std::forward<Key>(key)),
+                                                    std::forward_as_tuple(std::forward<Args>(args)...));
+                return {m_table.make_iterator(result.first), result.second};
+            } else {
+                return try_emplace(K(std::forward<Key>(key)), std::forward<Args>(args)...);
+            }
+        }
+
+        template<typename ...Args>
+        std::pair<iterator, bool> emplace(const K &key, Args &&... args) {
+            return try_emplace(key, std::forward<Args>(args)...);
+        }
+
+        template<typename ...Args>
+        std::pair<iterator, bool> emplace(K &&key, Args &&... args) {
+            return try_emplace(std::move(key), std::forward<Args>(args)...);
+        }
+
+        std::pair<iterator, bool> insert(const value_type &value) {
+            return try_emplace(value.first, value.second);
+        }
+
+        // 右值的 pair<K, V> 可以移动键
+        template<typename P, std::enable_if_t<std::is_constructible_v<value_type, P &&>, int> = 0>
+        std::pair<iterator, bool> insert(P &&value) {
+            return try_emplace(std::forward<P>(value).first, std::forward<P>(value).second);
+        }
+
+        template<typename InputIt, std::enable_if_t<is_iterator_v<InputIt>, int> = 0>
+        void insert(InputIt first, InputIt last) {
+            if constexpr (std::is_base_of_v<std::forward_iterator_tag, iterator_t<InputIt>>) {
+                reserve(size() + std::distance(first, last));
+            }
+            for (; first != last; ++first) try_emplace(first->first, first->second);
+        }
+
+        void insert(std::initializer_list<value_type> values) {
+            insert(values.begin(), values.end());
+        }
+
+        template<typename Key, typename Value>
+        std::pair<iterator, bool> insert_or_assign(Key &&key, Value &&value) {
+            auto result = try_emplace(std::forward<Key>(key), std::forward<Value>(value));
+            if (!result.second) {
+                result.first->second = std::forward<Value>(value);
+            }
+            return result;
+        }
+
+        template<typename Key, std::enable_if_t<std::is_constructible_v<K, Key &&>, int> = 0>
+        V &operator[](Key &&key) {
+            return try_emplace(std::forward<Key>(key)).first->second;
+        }
+
+        // 返回下一个元素的位置，其他元素的位置不变
+        iterator erase(const_iterator iter) {
+            const size_t i = m_table.index_of(iter);
+            m_table.erase_at(i);
+            return m_table.make_iterator(i);
+        }
+
+        iterator erase(iterator iter) {
+            return erase(const_iterator(iter));
+        }
+
+        template<typename Key = K, std::enable_if_t<detail::lookup_arg_v<K, Hash, Key>, int> = 0>
+        size_t erase(const Key &key) {
+            const size_t i = m_table.find(detail::lookup_key<K, Hash>(key));
+            if (i == table_type::npos) return 0;
+            m_table.erase_at(i);
+            return 1;
+        }
+
+        template<typename Key = K, std::enable_if_t<detail::lookup_arg_v<K, Hash, Key>, int> = 0>
+        iterator find(const Key &key) {
+            const size_t i = m_table.find(detail::lookup_key<K, Hash>(key));
+            return i == table_type::npos ? end() : m_table.make_iterator(i);
+        }
+
+        template<typename Key = K, std::enable_if_t<detail::lookup_arg_v<K, Hash, Key>, int> = 0>
+        const_iterator find(const Key &key) const {
+            const size_t i = m_table.find(detail::lookup_key<K, Hash>(key));
+            return i == table_type::npos ? end() : m_table.make_iterator(i);
+        }
+
+        template<typename Key = K, std::enable_if_t<detail::lookup_arg_v<K, Hash, Key>, int> = 0>
+        bool contains(const Key &key) const {
+            return m_table.find(detail::lookup_key<K, Hash>(key)) != table_type::npos;
+        }
+
+        template<typename Key = K, std::enable_if_t<detail::lookup_arg_v<K, Hash, Key>, int> = 0>
+        size_t count(const Key &key) const {
+            return contains(key);
+        }
+
+        template<typename Key = K, std::enable_if_t<detail::lookup_arg_v<K, Hash, Key>, int> = 0>
+        V &at(const Key &key) {
+            return const_cast<V &>(static_cast<const HashMap &>(*this).at(key));
+        }
+
+        template<typename Key = K, std::enable_if_t<detail::lookup_arg_v<K, Hash, Key>, int> = 0>
+        const V &at(const Key &key) const {
+            const size_t i = m_table.find(detail::lookup_key<K, Hash>(key));
+            if (i == table_type::npos) {
+                throw std::out_of_range(out_of_range);
+            }
+            return m_table.slot(i).second;
+        }
+
+        void swap(HashMap &other) noexcept {
+            m_table.swap(other.m_table);
+        }
+
+        Hash hash_function() const {
+            return m_table.hash_function();
+        }
+
+        KeyEqual key_eq() const {
+            return m_table.key_eq();
+        }
+
+        Alloc get_allocator() const {
+            return m_table.get_allocator();
+        }
+
+        friend bool operator==(const HashMap &a, const HashMap &b) {
+            if (a.size() != b.size()) return false;
+            for (const value_type &item : a) {
+                const auto iter = b.find(item.first);
+                if (iter == b.end() || !(iter->second == item.second)) return false;
+            }
+            return true;
+        }
+
+        friend bool operator!=(const HashMap &a, const HashMap &b) {
+            return !(a == b);
+        }
+    };
+
+} // namespace stl
+
+#endif //STL_HASHMAP_HPP
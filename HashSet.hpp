@@ -0,0 +1,181 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#ifndef STL_HASHSET_HPP
+#define STL_HASHSET_HPP
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include "Hash.hpp"
+#include "HashTable.hpp"
+#include "Utility.hpp"
+
+namespace stl {
+
+    // 开放寻址的散列集合，与 HashMap 共用同一种表结构
+    template<typename K, typename Hash = stl::Hash<K>, typename KeyEqual = std::equal_to<>,
+            typename Alloc = std::allocator<K>>
+    class HashSet {
+    private:
+        using table_type = detail::HashTable<detail::SetPolicy<K>, Hash, KeyEqual, Alloc>;
+
+        table_type m_table;
+
+    public:
+        using key_type = K;
+        using value_type = K;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+        using allocator_type = Alloc;
+        using iterator = typename table_type::const_iterator;
+        using const_iterator = typename table_type::const_iterator;
+
+        HashSet() = default;
+
+        // 预留 n 个元素的空间
+        explicit HashSet(size_t n, const Hash &hash = Hash(), const KeyEqual &eq = KeyEqual(),
+                         const Alloc &alloc = Alloc())
+                : m_table(n, hash, eq, alloc) {}
+
+        template<typename InputIt, std::enable_if_t<is_iterator_v<InputIt>, int> = 0>
+        HashSet(InputIt first, InputIt last, size_t n = 0, const Hash &hash = Hash(), const KeyEqual &eq = KeyEqual(),
+                const Alloc &alloc = Alloc())
+                : m_table(n, hash, eq, alloc) {
+            insert(first, last);
+        }
+
+        HashSet(std::initializer_list<K> keys, size_t n = 0, const Hash &hash = Hash(),
+                const KeyEqual &eq = KeyEqual(), const Alloc &alloc = Alloc())
+                : HashSet(keys.begin(), keys.end(), n ? n : keys.size(), hash, eq, alloc) {}
+
+        iterator begin() const noexcept {
+            return m_table.begin();
+        }
+
+        iterator end() const noexcept {
+            return m_table.end();
+        }
+
+        size_t size() const noexcept {
+            return m_table.size();
+        }
+
+        bool empty() const noexcept {
+            return m_table.size() == 0;
+        }
+
+        size_t capacity() const noexcept {
+            return m_table.capacity();
+        }
+
+        double load_factor() const noexcept {
+            return capacity() ? static_cast<double>(size()) / static_cast<double>(capacity()) : 0.0;
+        }
+
+        void reserve(size_t n) {
+            m_table.reserve(n);
+        }
+
+        void shrink_to_fit() {
+            m_table.shrink_to_fit();
+        }
+
+        void clear() noexcept {
+            m_table.clear();
+        }
+
+        // 可以直接查找的键类型只在插入时才构造 K
+        template<typename Key, std::enable_if_t<std::is_constructible_v<K, Key &&>, int> = 0>
+        std::pair<iterator, bool> insert(Key &&key) {
+            if constexpr (detail::direct_lookup_v<K, Hash, std::decay_t<Key>>) {
+                const auto result = m_table.emplace(key, std::forward<Key>(key));
+                return {m_table.make_iterator(result.first), result.second};
+            } else {
+                return insert(K(std::forward<Key>(key)));
+            }
+        }
+
+        template<typename InputIt, std::enable_if_t<is_iterator_v<InputIt>, int> = 0>
+        void insert(InputIt first, InputIt last) {
+            if constexpr (std::is_base_of_v<std::forward_iterator_tag, iterator_t<InputIt>>) {
+                reserve(size() + std::distance(first, last));
+            }
+            for (; first != last; ++first) insert(*first);
+        }
+
+        void insert(std::initializer_list<K> keys) {
+            insert(keys.begin(), keys.end());
+        }
+
+        template<typename ...Args>
+        std::pair<iterator, bool> emplace(Args &&... args) {
+            return insert(K(std::forward<Args>(args)...));
+        }
+
+        iterator erase(const_iterator iter) {
+            const size_t i = m_table.index_of(iter);
+            m_table.erase_at(i);
+            return static_cast<const table_type &>(m_table).make_iterator(i);
+        }
+
+        template<typename Key = K, std::enable_if_t<detail::lookup_arg_v<K, Hash, Key>, int> = 0>
+        size_t erase(const Key &key) {
+            const size_t i = m_table.find(detail::lookup_key<K, Hash>(key));
+            if (i == table_type::npos) return 0;
+            m_table.erase_at(i);
+            return 1;
+        }
+
+        template<typename Key = K, std::enable_if_t<detail::lookup_arg_v<K, Hash, Key>, int> = 0>
+        iterator find(const Key &key) const {
+            const size_t i = m_table.find(detail::lookup_key<K, Hash>(key));
+            return i == table_type::npos ? end() : m_table.make_iterator(i);
+        }
+
+        template<typename Key = K, std::enable_if_t<detail::lookup_arg_v<K, Hash, Key>, int> = 0>
+        bool contains(const Key &key) const {
+            return m_table.find(detail::lookup_key<K, Hash>(key)) != table_type::npos;
+        }
+
+        template<typename Key = K, std::enable_if_t<detail::lookup_arg_v<K, Hash, Key>, int> = 0>
+        size_t count(const Key &key) const {
+            return contains(key);
+        }
+
+        void swap(HashSet &other) noexcept {
+            m_table.swap(other.m_table);
+        }
+
+        Hash hash_function() const {
+            return m_table.hash_function();
+        }
+
+        KeyEqual key_eq() const {
+            return m_table.key_eq();
+        }
+
+        Alloc get_allocator() const {
+            return m_table.get_allocator();
+        }
+
+        friend bool operator==(const HashSet &a, const HashSet &b) {
+            if (a.size() != b.size()) return false;
+            for (const K &key : a) {
+                if (!b.contains(key)) return false;
+            }
+            return true;
+        }
+
+        friend bool operator!=(const HashSet &a, const HashSet &b) {
+            return !(a == b);
+        }
+    };
+
+} // namespace stl
+
+#endif //STL_HASHSET_HPP
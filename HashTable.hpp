@@ -0,0 +1,627 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#ifndef STL_HASHTABLE_HPP
+#define STL_HASHTABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "Instrument.hpp"
+#include "Uninitialized.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define STL_HASH_SSE2 1
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define STL_HASH_NEON 1
+#endif
+
+namespace stl {
+
+    namespace detail {
+
+        // 开放寻址表以 16 个槽位为一组，每个槽位对应一个控制字节:
+        // 最高位为 1 表示空槽，否则低 7 位是散列值的最高 7 位。查找时一条向量比较即可筛出组内的候选槽位
+        inline constexpr size_t group_width = 16;
+        inline constexpr uint8_t ctrl_empty = 0x80;
+
+        // 组内匹配结果，每个槽位占 (1 << shift) 位
+        class GroupMask {
+        private:
+            uint64_t m_bits;
+
+        public:
+#if defined(STL_HASH_NEON)
+            static constexpr int shift = 2;
+#else
+            static constexpr int shift = 0;
+#endif
+
+            explicit GroupMask(uint64_t bits) noexcept : m_bits(bits) {}
+
+            explicit operator bool() const noexcept {
+                return m_bits != 0;
+            }
+
+            // 最低的匹配槽位
+            size_t lowest() const noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+                return static_cast<size_t>(__builtin_ctzll(m_bits)) >> shift;
+#else
+                size_t i = 0;
+                while (!(m_bits >> i & 1)) ++i;
+                return i >> shift;
+#endif
+            }
+
+            GroupMask &operator++() noexcept {
+                m_bits &= m_bits - 1;
+                return *this;
+            }
+        };
+
+        // 等于 tag 的控制字节
+        inline GroupMask match_group(const uint8_t *ctrl, uint8_t tag) noexcept {
+#if defined(STL_HASH_SSE2)
+            const __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl));
+            return GroupMask(static_cast<uint32_t>(
+                    _mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(static_cast<char>(tag))))));
+#elif defined(STL_HASH_NEON)
+            // NEON 没有 movemask，把比较结果窄化为每字节 4 位
+            const uint8x16_t eq = vceqq_u8(vld1q_u8(ctrl), vdupq_n_u8(tag));
+            const uint8x8_t narrow = vshrn_n_u16(vreinterpretq_u16_u8(eq), 4);
+            return GroupMask(vget_lane_u64(vreinterpret_u64_u8(narrow), 0) & 0x8888888888888888ULL);
+#else
+            uint64_t bits = 0;
+            for (size_t i = 0; i < group_width; ++i) bits |= uint64_t(ctrl[i] == tag) << i;
+            return GroupMask(bits);
+#endif
+        }
+
+        // 空槽位
+        inline GroupMask match_empty(const uint8_t *ctrl) noexcept {
+#if defined(STL_HASH_SSE2)
+            const __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl));
+            return GroupMask(static_cast<uint32_t>(_mm_movemask_epi8(group)));
+#elif defined(STL_HASH_NEON)
+            const uint8x16_t empty = vtstq_u8(vld1q_u8(ctrl), vdupq_n_u8(ctrl_empty));
+            const uint8x8_t narrow = vshrn_n_u16(vreinterpretq_u16_u8(empty), 4);
+            return GroupMask(vget_lane_u64(vreinterpret_u64_u8(narrow), 0) & 0x8888888888888888ULL);
+#else
+            uint64_t bits = 0;
+            for (size_t i = 0; i < group_width; ++i) bits |= uint64_t(ctrl[i] >> 7) << i;
+            return GroupMask(bits);
+#endif
+        }
+
+        // 跳过空槽位的前向迭代器
+        template<typename Slot, bool Const>
+        class HashIterator {
+        private:
+            const uint8_t *m_ctrl;
+            const uint8_t *m_end;
+            Slot *m_slot;
+
+            template<typename, bool> friend class HashIterator;
+
+            void skip() noexcept {
+                while (m_ctrl != m_end && (*m_ctrl & ctrl_empty)) {
+                    ++m_ctrl;
+                    ++m_slot;
+                }
+            }
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::remove_const_t<Slot>;
+            using difference_type = std::ptrdiff_t;
+            using reference = std::conditional_t<Const, const Slot &, Slot &>;
+            using pointer = std::conditional_t<Const, const Slot *, Slot *>;
+
+            HashIterator() noexcept : m_ctrl(nullptr), m_end(nullptr), m_slot(nullptr) {}
+
+            HashIterator(const uint8_t *ctrl, const uint8_t *end, Slot *slot) noexcept
+                    : m_ctrl(ctrl), m_end(end), m_slot(slot) {
+                skip();
+            }
+
+            template<bool C = Const, std::enable_if_t<C, int> = 0>
+            HashIterator(const HashIterator<Slot, false> &other) noexcept
+                    : m_ctrl(other.m_ctrl), m_end(other.m_end), m_slot(other.m_slot) {}
+
+            reference operator*() const noexcept {
+                return *m_slot;
+            }
+
+            pointer operator->() const noexcept {
+                return m_slot;
+            }
+
+            HashIterator &operator++() noexcept {
+                ++m_ctrl;
+                ++m_slot;
+                skip();
+                return *this;
+            }
+
+            HashIterator operator++(int) noexcept {
+                HashIterator temp = *this;
+                ++*this;
+                return temp;
+            }
+
+            friend bool operator==(const HashIterator &a, const HashIterator &b) noexcept {
+                return a.m_ctrl == b.m_ctrl;
+            }
+
+            friend bool operator!=(const HashIterator &a, const HashIterator &b) noexcept {
+                return a.m_ctrl != b.m_ctrl;
+            }
+        };
+
+        // HashMap 的槽位: 键值对就地存放
+        template<typename K, typename V>
+        struct MapPolicy {
+            using key_type = K;
+            using slot_type = std::pair<const K, V>;
+
+            static constexpr bool trivially_relocatable = is_trivially_relocatable_v<K> && is_trivially_relocatable_v<V>;
+
+            static const K &key(const slot_type &slot) noexcept {
+                return slot.first;
+            }
+
+            // 扩容时把槽位搬到新表。键只在容器外部是 const 的，源槽位随后即被销毁，
+            // 键值都能无异常移动时直接移动键，否则复制以保证旧表在失败时完好
+            template<typename A>
+            static void transfer(A &alloc, slot_type *dest, slot_type *src) {
+                if constexpr (std::is_nothrow_move_constructible_v<K> && std::is_nothrow_move_constructible_v<V>) {
+                    std::allocator_traits<A>::construct(alloc, dest, std::piecewise_construct,
+                                                        std::forward_as_tuple(std::move(const_cast<K &>(src->first))),
+                                                        std::forward_as_tuple(std::move(src->second)));
+                } else {
+                    std::allocator_traits<A>::construct(alloc, dest, *src);
+                }
+            }
+        };
+
+        // HashSet 的槽位: 只有键
+        template<typename K>
+        struct SetPolicy {
+            using key_type = K;
+            using slot_type = K;
+
+            static constexpr bool trivially_relocatable = is_trivially_relocatable_v<K>;
+
+            static const K &key(const slot_type &slot) noexcept {
+                return slot;
+            }
+
+            template<typename A>
+            static void transfer(A &alloc, slot_type *dest, slot_type *src) {
+                std::allocator_traits<A>::construct(alloc, dest, std::move_if_noexcept(*src));
+            }
+        };
+
+        // Swiss table 风格的开放寻址散列表，HashMap 与 HashSet 共用。
+        // 组之间按三角数序列探测 (组数为 2 的幂时可以遍历所有组)。每组另有一个溢出计数，
+        // 记录从该组继续向后探测才放下的元素个数: 查找在计数为 0 的组停止，删除时沿探测路径减回，
+        // 槽位直接变为空槽，因此不需要墓碑，反复插入删除也不会让查找变长
+        template<typename Policy, typename Hash, typename KeyEqual, typename Alloc>
+        class HashTable : private Alloc {
+        public:
+            using key_type = typename Policy::key_type;
+            using slot_type = typename Policy::slot_type;
+            using iterator = HashIterator<slot_type, false>;
+            using const_iterator = HashIterator<slot_type, true>;
+
+            static constexpr size_t npos = size_t(-1);
+
+        private:
+            using alloc_traits = std::allocator_traits<Alloc>;
+            using byte_allocator = typename alloc_traits::template rebind_alloc<uint8_t>;
+            using byte_traits = std::allocator_traits<byte_allocator>;
+
+            static constexpr uint8_t overflow_max = 0xff; // 饱和后不再减少
+
+            uint8_t *m_ctrl;     // 每个槽位一个控制字节，之后是每组一个溢出计数
+            slot_type *m_slots;
+            size_t m_groups;     // 0 或 2 的幂
+            size_t m_size;
+            Hash m_hash;
+            KeyEqual m_eq;
+
+            Alloc &alloc() noexcept {
+                return *this;
+            }
+
+            const Alloc &alloc() const noexcept {
+                return *this;
+            }
+
+            static uint8_t tag_of(size_t hash) noexcept {
+                return static_cast<uint8_t>(hash >> (sizeof(size_t) * 8 - 7));
+            }
+
+            static size_t ctrl_bytes(size_t groups) noexcept {
+                return groups * group_width + groups;
+            }
+
+            uint8_t *overflow() const noexcept {
+                return m_ctrl + m_groups * group_width;
+            }
+
+            // 最多 7/8 的槽位有元素
+            size_t growth_limit() const noexcept {
+                return m_groups * (group_width - group_width / 8);
+            }
+
+            static size_t groups_for(size_t n) noexcept {
+                if (n == 0) return 0;
+                size_t groups = 1;
+                while (groups * (group_width - group_width / 8) < n) groups <<= 1;
+                return groups;
+            }
+
+            void allocate(size_t groups) {
+                byte_allocator bytes(alloc());
+                uint8_t *ctrl = byte_traits::allocate(bytes, ctrl_bytes(groups));
+                try {
+                    m_slots = alloc_traits::allocate(alloc(), groups * group_width);
+                } catch (...) {
+                    byte_traits::deallocate(bytes, ctrl, ctrl_bytes(groups));
+                    throw;
+                }
+                instrument::allocated<HashTable>(ctrl_bytes(groups) + groups * group_width * sizeof(slot_type));
+                m_ctrl = ctrl;
+                m_groups = groups;
+                std::memset(m_ctrl, ctrl_empty, groups * group_width);
+                std::memset(overflow(), 0, groups);
+            }
+
+            void deallocate() noexcept {
+                if (m_groups == 0) return;
+                instrument::freed<HashTable>(ctrl_bytes(m_groups) + m_groups * group_width * sizeof(slot_type));
+                byte_allocator bytes(alloc());
+                byte_traits::deallocate(bytes, m_ctrl, ctrl_bytes(m_groups));
+                alloc_traits::deallocate(alloc(), m_slots, m_groups * group_width);
+                m_ctrl = nullptr;
+                m_slots = nullptr;
+                m_groups = 0;
+            }
+
+            void destroy_all() noexcept {
+                if constexpr (!std::is_trivially_destructible_v<slot_type>) {
+                    for (size_t i = 0, n = m_groups * group_width; i < n; ++i) {
+                        if (!(m_ctrl[i] & ctrl_empty)) alloc_traits::destroy(alloc(), m_slots + i);
+                    }
+                }
+            }
+
+            // 探测路径上第一个空槽位，要求表未满
+            size_t find_empty(size_t hash) const noexcept {
+                const size_t mask = m_groups - 1;
+                size_t g = hash & mask;
+                for (size_t step = 0;; g = (g + ++step) & mask) {
+                    const GroupMask empty = match_empty(m_ctrl + g * group_width);
+                    if (empty) return g * group_width + empty.lowest();
+                }
+            }
+
+            // 元素放在 group 组时，为其之前经过的组增减溢出计数
+            void add_overflow(size_t hash, size_t group) noexcept {
+                const size_t mask = m_groups - 1;
+                uint8_t *counts = overflow();
+                for (size_t g = hash & mask, step = 0; g != group; g = (g + ++step) & mask) {
+                    if (counts[g] != overflow_max) ++counts[g];
+                }
+            }
+
+            void remove_overflow(size_t hash, size_t group) noexcept {
+                const size_t mask = m_groups - 1;
+                uint8_t *counts = overflow();
+                for (size_t g = hash & mask, step = 0; g != group; g = (g + ++step) & mask) {
+                    if (counts[g] != overflow_max) --counts[g];
+                }
+            }
+
+            void occupy(size_t i, size_t hash) noexcept {
+                m_ctrl[i] = tag_of(hash);
+                add_overflow(hash, i / group_width);
+            }
+
+            // 重新分配为 groups 组。槽位能够无异常搬运时逐个搬运，否则先全部复制，
+            // 复制失败时释放新表，旧表保持不变
+            void rehash(size_t groups) {
+                uint8_t *old_ctrl = m_ctrl;
+                slot_type *old_slots = m_slots;
+                const size_t old_groups = m_groups;
+                m_groups = 0;
+                try {
+                    allocate(groups);
+                } catch (...) {
+                    m_ctrl = old_ctrl;
+                    m_slots = old_slots;
+                    m_groups = old_groups;
+                    throw;
+                }
+                instrument::reallocated<HashTable>();
+                instrument::moved<HashTable>(m_size * sizeof(slot_type));
+
+                const size_t old_capacity = old_groups * group_width;
+                try {
+                    for (size_t i = 0; i < old_capacity; ++i) {
+                        if (old_ctrl[i] & ctrl_empty) continue;
+                        const size_t hash = m_hash(Policy::key(old_slots[i]));
+                        const size_t j = find_empty(hash);
+                        if constexpr (Policy::trivially_relocatable) {
+                            std::memcpy(static_cast<void *>(m_slots + j), old_slots + i, sizeof(slot_type));
+                        } else {
+                            Policy::transfer(alloc(), m_slots + j, old_slots + i);
+                        }
+                        occupy(j, hash);
+                    }
+                } catch (...) {
+                    destroy_all();
+                    deallocate();
+                    m_ctrl = old_ctrl;
+                    m_slots = old_slots;
+                    m_groups = old_groups;
+                    throw;
+                }
+
+                if (old_groups) {
+                    if constexpr (!Policy::trivially_relocatable && !std::is_trivially_destructible_v<slot_type>) {
+                        for (size_t i = 0; i < old_capacity; ++i) {
+                            if (!(old_ctrl[i] & ctrl_empty)) alloc_traits::destroy(alloc(), old_slots + i);
+                        }
+                    }
+                    instrument::freed<HashTable>(ctrl_bytes(old_groups) + old_capacity * sizeof(slot_type));
+                    byte_allocator bytes(alloc());
+                    byte_traits::deallocate(bytes, old_ctrl, ctrl_bytes(old_groups));
+                    alloc_traits::deallocate(alloc(), old_slots, old_capacity);
+                }
+            }
+
+            // 组数相同，直接复制控制字节，槽位复制（右值时移动）到相同位置，不需要重新散列。要求本表为空
+            template<typename Table>
+            void clone(Table &&other) {
+                using source = std::conditional_t<std::is_lvalue_reference_v<Table>, const slot_type &, slot_type &&>;
+                if (other.m_size == 0) return;
+                allocate(other.m_groups);
+                const size_t capacity = m_groups * group_width;
+                size_t i = 0;
+                try {
+                    for (; i < capacity; ++i) {
+                        if (!(other.m_ctrl[i] & ctrl_empty)) {
+                            alloc_traits::construct(alloc(), m_slots + i, static_cast<source>(other.m_slots[i]));
+                            m_ctrl[i] = other.m_ctrl[i];
+                        }
+                    }
+                } catch (...) {
+                    destroy_all();
+                    deallocate();
+                    throw;
+                }
+                std::memcpy(overflow(), other.overflow(), m_groups);
+                m_size = other.m_size;
+            }
+
+        public:
+            explicit HashTable(size_t n = 0, const Hash &hash = Hash(), const KeyEqual &eq = KeyEqual(),
+                               const Alloc &alloc = Alloc())
+                    : Alloc(alloc), m_ctrl(nullptr), m_slots(nullptr), m_groups(0), m_size(0), m_hash(hash), m_eq(eq) {
+                if (n) allocate(groups_for(n));
+            }
+
+            HashTable(const HashTable &other)
+                    : Alloc(alloc_traits::select_on_container_copy_construction(other.alloc())),
+                      m_ctrl(nullptr), m_slots(nullptr), m_groups(0), m_size(0), m_hash(other.m_hash), m_eq(other.m_eq) {
+                clone(other);
+            }
+
+            HashTable(HashTable &&other) noexcept
+                    : Alloc(std::move(other.alloc())), m_ctrl(other.m_ctrl), m_slots(other.m_slots),
+                      m_groups(other.m_groups), m_size(other.m_size), m_hash(other.m_hash), m_eq(other.m_eq) {
+                other.m_ctrl = nullptr;
+                other.m_slots = nullptr;
+                other.m_groups = other.m_size = 0;
+            }
+
+            ~HashTable() {
+                destroy_all();
+                deallocate();
+            }
+
+            HashTable &operator=(const HashTable &other) {
+                if (this == &other) return *this;
+                if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+                    if (alloc() != other.alloc()) { // 旧内存必须由旧分配器释放
+                        destroy_all();
+                        deallocate();
+                        m_size = 0;
+                    }
+                    alloc() = other.alloc();
+                }
+                // 临时表使用本表的分配器，swap 不交换分配器时内存也不会错配
+                HashTable temp(0, other.m_hash, other.m_eq, alloc());
+                temp.clone(other);
+                swap(temp);
+                return *this;
+            }
+
+            HashTable &operator=(HashTable &&other) noexcept(alloc_traits::propagate_on_container_move_assignment::value ||
+                                                             alloc_traits::is_always_equal::value) {
+                if (this == &other) return *this;
+                if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+                    destroy_all();
+                    deallocate();
+                    m_size = 0;
+                    alloc() = std::move(other.alloc());
+                } else if (alloc() != other.alloc()) { // 分配器不同，只能逐个移动元素
+                    HashTable temp(0, other.m_hash, other.m_eq, alloc());
+                    temp.clone(std::move(other));
+                    swap(temp);
+                    other.clear();
+                    return *this;
+                }
+                HashTable temp(std::move(other));
+                swap(temp);
+                return *this;
+            }
+
+            void swap(HashTable &other) noexcept {
+                using std::swap;
+                if constexpr (alloc_traits::propagate_on_container_swap::value) {
+                    swap(alloc(), other.alloc());
+                }
+                swap(m_ctrl, other.m_ctrl);
+                swap(m_slots, other.m_slots);
+                swap(m_groups, other.m_groups);
+                swap(m_size, other.m_size);
+                swap(m_hash, other.m_hash);
+                swap(m_eq, other.m_eq);
+            }
+
+            template<typename Key>
+            size_t find(const Key &key, size_t hash) const {
+                if (m_size == 0) return npos;
+                const uint8_t tag = tag_of(hash);
+                const size_t mask = m_groups - 1;
+                size_t g = hash & mask;
+                for (size_t step = 0; step < m_groups; g = (g + ++step) & mask) {
+                    const uint8_t *ctrl = m_ctrl + g * group_width;
+                    for (GroupMask match = match_group(ctrl, tag); match; ++match) {
+                        const size_t i = g * group_width + match.lowest();
+                        if (m_eq(Policy::key(m_slots[i]), key)) return i;
+                    }
+                    if (overflow()[g] == 0) break;
+                }
+                return npos;
+            }
+
+            // 返回槽位下标，不存在时返回 npos
+            template<typename Key>
+            size_t find(const Key &key) const {
+                return find(key, m_hash(key));
+            }
+
+            // key 不存在时用 args 构造槽位。返回槽位下标以及是否插入了新元素
+            template<typename Key, typename ...Args>
+            std::pair<size_t, bool> emplace(const Key &key, Args &&... args) {
+                const size_t hash = m_hash(key);
+                const size_t found = find(key, hash);
+                if (found != npos) return {found, false};
+                if (m_size >= growth_limit()) {
+                    rehash(m_groups ? m_groups * 2 : 1);
+                }
+                const size_t i = find_empty(hash);
+                alloc_traits::construct(alloc(), m_slots + i, std::forward<Args>(args)...);
+                occupy(i, hash);
+                ++m_size;
+                return {i, true};
+            }
+
+            void erase_at(size_t i) noexcept {
+                const size_t hash = m_hash(Policy::key(m_slots[i]));
+                remove_overflow(hash, i / group_width);
+                alloc_traits::destroy(alloc(), m_slots + i);
+                m_ctrl[i] = ctrl_empty;
+                --m_size;
+            }
+
+            // 保留已分配的内存
+            void clear() noexcept {
+                if (m_groups == 0) return;
+                destroy_all();
+                std::memset(m_ctrl, ctrl_empty, m_groups * group_width);
+                std::memset(overflow(), 0, m_groups);
+                m_size = 0;
+            }
+
+            // 保证容纳 n 个元素之前不再扩容
+            void reserve(size_t n) {
+                const size_t groups = groups_for(n);
+                if (groups > m_groups) rehash(groups);
+            }
+
+            void shrink_to_fit() {
+                const size_t groups = groups_for(m_size);
+                if (groups == m_groups) return;
+                if (groups == 0) {
+                    deallocate();
+                } else {
+                    rehash(groups);
+                }
+            }
+
+            slot_type &slot(size_t i) noexcept {
+                return m_slots[i];
+            }
+
+            const slot_type &slot(size_t i) const noexcept {
+                return m_slots[i];
+            }
+
+            size_t index_of(const_iterator iter) const noexcept {
+                return &*iter - m_slots;
+            }
+
+            iterator make_iterator(size_t i) noexcept {
+                return iterator(m_ctrl + i, m_ctrl + m_groups * group_width, m_slots + i);
+            }
+
+            const_iterator make_iterator(size_t i) const noexcept {
+                return const_iterator(m_ctrl + i, m_ctrl + m_groups * group_width, m_slots + i);
+            }
+
+            iterator begin() noexcept {
+                return make_iterator(0);
+            }
+
+            iterator end() noexcept {
+                return make_iterator(m_groups * group_width);
+            }
+
+            const_iterator begin() const noexcept {
+                return make_iterator(0);
+            }
+
+            const_iterator end() const noexcept {
+                return make_iterator(m_groups * group_width);
+            }
+
+            size_t size() const noexcept {
+                return m_size;
+            }
+
+            size_t capacity() const noexcept {
+                return m_groups * group_width;
+            }
+
+            Hash hash_function() const {
+                return m_hash;
+            }
+
+            KeyEqual key_eq() const {
+                return m_eq;
+            }
+
+            Alloc get_allocator() const {
+                return alloc();
+            }
+        };
+
+    } // namespace detail
+
+} // namespace stl
+
+#endif //STL_HASHTABLE_HPP
@@ -0,0 +1,365 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#ifndef STL_INSTRUMENT_HPP
+#define STL_INSTRUMENT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// 内存分配与数据搬运的统计，编译时定义 STL_INSTRUMENT=1 开启 (所有翻译单元包括 String.cpp 必须一致)。
+// 关闭时所有钩子都是空的内联函数，不产生任何代码；snapshot() 返回空表。
+//
+// 统计按容器类型分组，此外还可以用 STL_INSTRUMENT_SCOPE("tag") 为当前线程的一段代码打上标签，
+// 期间发生的事件会同时计入 (类型, 标签) 分组，用来定位频繁扩容的调用位置:
+//     {
+//         STL_INSTRUMENT_SCOPE("load_index");
+//         load(index);
+//     }
+//     stl::instrument::dump_json(std::cout);
+// 标签必须是字符串字面量或生命周期足够长的字符串
+
+#ifndef STL_INSTRUMENT
+#define STL_INSTRUMENT 0
+#endif
+
+#if STL_INSTRUMENT
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <typeinfo>
+#include <utility>
+#endif
+
+#define STL_INSTRUMENT_CONCAT_IMPL(a, b) a##b
+#define STL_INSTRUMENT_CONCAT(a, b) STL_INSTRUMENT_CONCAT_IMPL(a, b)
+#define STL_INSTRUMENT_SCOPE(tag) ::stl::instrument::Scope STL_INSTRUMENT_CONCAT(stl_instrument_scope_, __LINE__)(tag)
+
+namespace stl {
+    namespace instrument {
+
+        inline constexpr bool enabled = STL_INSTRUMENT != 0;
+
+        // 某一分组的计数快照。带标签的分组按事件发生时的标签归类，
+        // 在别的标签下释放的内存会使 live_bytes 为负，峰值只对不带标签的分组有意义
+        struct Stats {
+            std::string type;
+            std::string tag;             // 空串表示该类型的总计
+            uint64_t allocations = 0;
+            uint64_t deallocations = 0;
+            uint64_t bytes_allocated = 0;
+            uint64_t bytes_freed = 0;
+            uint64_t reallocations = 0;  // 已有缓冲区的容量改变次数 (换新内存或原地扩缩)
+            uint64_t bytes_moved = 0;    // 扩容、插入、删除时搬运元素的字节数
+            int64_t live_bytes = 0;
+            uint64_t peak_bytes = 0;     // live_bytes 的最大值
+            uint64_t peak_capacity = 0;  // 单个缓冲区的最大字节数
+        };
+
+        namespace detail {
+            inline void write_json_string(std::ostream &out, const std::string &str) {
+                static const char hex[] = "0123456789abcdef";
+                out << '"';
+                for (const char c : str) {
+                    if (c == '"' || c == '\\') {
+                        out << '\\' << c;
+                    } else if (static_cast<unsigned char>(c) < 0x20) {
+                        out << "\\u00" << hex[(c >> 4) & 0xF] << hex[c & 0xF];
+                    } else {
+                        out << c;
+                    }
+                }
+                out << '"';
+            }
+        } // namespace detail
+
+#if STL_INSTRUMENT
+        namespace detail {
+            // 从函数签名中取出类型名，不依赖 RTTI
+            template<typename T>
+            std::string type_name() {
+#if defined(__GNUC__) || defined(__clang__)
+                const std::string signature = __PRETTY_FUNCTION__;
+                const size_t begin = signature.find("T = ") + 4;
+                const size_t end = signature.find_first_of(";]", begin);
+                return signature.substr(begin, end - begin);
+#else
+                return typeid(T).name();
+#endif
+            }
+
+            struct Counters {
+                std::atomic<uint64_t> allocations{0};
+                std::atomic<uint64_t> deallocations{0};
+                std::atomic<uint64_t> bytes_allocated{0};
+                std::atomic<uint64_t> bytes_freed{0};
+                std::atomic<uint64_t> reallocations{0};
+                std::atomic<uint64_t> bytes_moved{0};
+                std::atomic<int64_t> live_bytes{0};
+                std::atomic<uint64_t> peak_bytes{0};
+                std::atomic<uint64_t> peak_capacity{0};
+
+                static void raise(std::atomic<uint64_t> &peak, uint64_t value) noexcept {
+                    uint64_t cur = peak.load(std::memory_order_relaxed);
+                    while (value > cur && !peak.compare_exchange_weak(cur, value, std::memory_order_relaxed)) {}
+                }
+
+                void add_live(int64_t delta) noexcept {
+                    const int64_t live = live_bytes.fetch_add(delta, std::memory_order_relaxed) + delta;
+                    if (live > 0) raise(peak_bytes, static_cast<uint64_t>(live));
+                }
+
+                void on_allocate(size_t bytes) noexcept {
+                    allocations.fetch_add(1, std::memory_order_relaxed);
+                    bytes_allocated.fetch_add(bytes, std::memory_order_relaxed);
+                    raise(peak_capacity, bytes);
+                    add_live(static_cast<int64_t>(bytes));
+                }
+
+                void on_free(size_t bytes) noexcept {
+                    deallocations.fetch_add(1, std::memory_order_relaxed);
+                    bytes_freed.fetch_add(bytes, std::memory_order_relaxed);
+                    add_live(-static_cast<int64_t>(bytes));
+                }
+
+                void on_resize(size_t old_bytes, size_t new_bytes) noexcept {
+                    reallocations.fetch_add(1, std::memory_order_relaxed);
+                    if (new_bytes > old_bytes) {
+                        bytes_allocated.fetch_add(new_bytes - old_bytes, std::memory_order_relaxed);
+                        raise(peak_capacity, new_bytes);
+                    } else {
+                        bytes_freed.fetch_add(old_bytes - new_bytes, std::memory_order_relaxed);
+                    }
+                    add_live(static_cast<int64_t>(new_bytes) - static_cast<int64_t>(old_bytes));
+                }
+
+                void on_reallocate() noexcept {
+                    reallocations.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                void on_move(size_t bytes) noexcept {
+                    bytes_moved.fetch_add(bytes, std::memory_order_relaxed);
+                }
+
+                void clear() noexcept {
+                    for (auto *c: {&allocations, &deallocations, &bytes_allocated, &bytes_freed,
+                                   &reallocations, &bytes_moved, &peak_bytes, &peak_capacity}) {
+                        c->store(0, std::memory_order_relaxed);
+                    }
+                    live_bytes.store(0, std::memory_order_relaxed);
+                }
+            };
+
+            // 所有分组的登记表，分组创建后地址不变，只在登记新分组时加锁。
+            // 故意不析构，静态对象析构期间发生的释放仍然可以计数
+            class Registry {
+            private:
+                std::mutex m_mutex;
+                std::map<std::pair<std::string, std::string>, std::unique_ptr<Counters>> m_groups;
+
+            public:
+                static Registry &instance() {
+                    static Registry *registry = new Registry();
+                    return *registry;
+                }
+
+                Counters &get(std::string type, std::string tag) {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    auto &slot = m_groups[{std::move(type), std::move(tag)}];
+                    if (!slot) slot = std::make_unique<Counters>();
+                    return *slot;
+                }
+
+                std::vector<Stats> snapshot() {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    std::vector<Stats> result;
+                    result.reserve(m_groups.size());
+                    for (const auto &[key, c]: m_groups) {
+                        Stats s;
+                        s.type = key.first;
+                        s.tag = key.second;
+                        s.allocations = c->allocations.load(std::memory_order_relaxed);
+                        s.deallocations = c->deallocations.load(std::memory_order_relaxed);
+                        s.bytes_allocated = c->bytes_allocated.load(std::memory_order_relaxed);
+                        s.bytes_freed = c->bytes_freed.load(std::memory_order_relaxed);
+                        s.reallocations = c->reallocations.load(std::memory_order_relaxed);
+                        s.bytes_moved = c->bytes_moved.load(std::memory_order_relaxed);
+                        s.live_bytes = c->live_bytes.load(std::memory_order_relaxed);
+                        s.peak_bytes = c->peak_bytes.load(std::memory_order_relaxed);
+                        s.peak_capacity = c->peak_capacity.load(std::memory_order_relaxed);
+                        result.push_back(std::move(s));
+                    }
+                    return result;
+                }
+
+                void reset() {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    for (auto &group: m_groups) group.second->clear();
+                }
+            };
+
+            inline thread_local const char *current_tag = nullptr;
+
+            // 登记失败 (内存不足) 时返回 nullptr，该事件不计数
+            template<typename C>
+            Counters *counters() noexcept {
+                static Counters *const group = []() noexcept -> Counters * {
+                    try {
+                        return &Registry::instance().get(type_name<C>(), std::string());
+                    } catch (...) {
+                        return nullptr;
+                    }
+                }();
+                return group;
+            }
+
+            // 每个线程缓存最近一次使用的标签，标签不变时不需要查表
+            template<typename C>
+            Counters *tagged_counters() noexcept {
+                thread_local const char *cached_tag = nullptr;
+                thread_local Counters *cached = nullptr;
+                const char *tag = current_tag;
+                if (tag == nullptr) return nullptr;
+                if (tag != cached_tag) {
+                    try {
+                        cached = &Registry::instance().get(type_name<C>(), tag);
+                        cached_tag = tag;
+                    } catch (...) {
+                        return nullptr;
+                    }
+                }
+                return cached;
+            }
+
+            template<typename C, typename F>
+            void record(F f) noexcept {
+                if (Counters *c = counters<C>()) f(*c);
+                if (Counters *c = tagged_counters<C>()) f(*c);
+            }
+        } // namespace detail
+
+        // 以下钩子由容器调用，C 是发生事件的容器类型
+
+        // 申请了一块新内存
+        template<typename C>
+        void allocated(size_t bytes) noexcept {
+            detail::record<C>([bytes](detail::Counters &c) { c.on_allocate(bytes); });
+        }
+
+        // 释放了一块内存
+        template<typename C>
+        void freed(size_t bytes) noexcept {
+            detail::record<C>([bytes](detail::Counters &c) { c.on_free(bytes); });
+        }
+
+        // 已有的缓冲区被原地扩大或缩小
+        template<typename C>
+        void resized(size_t old_bytes, size_t new_bytes) noexcept {
+            detail::record<C>([=](detail::Counters &c) { c.on_resize(old_bytes, new_bytes); });
+        }
+
+        // 元素被搬到了一块新内存中，新旧内存的申请和释放另行计数
+        template<typename C>
+        void reallocated() noexcept {
+            detail::record<C>([](detail::Counters &c) { c.on_reallocate(); });
+        }
+
+        template<typename C>
+        void moved(size_t bytes) noexcept {
+            if (bytes) detail::record<C>([bytes](detail::Counters &c) { c.on_move(bytes); });
+        }
+
+        // 在作用域内为当前线程打上标签，可以嵌套，离开时恢复外层的标签
+        class Scope {
+        private:
+            const char *m_prev;
+
+        public:
+            explicit Scope(const char *tag) noexcept : m_prev(detail::current_tag) {
+                detail::current_tag = tag;
+            }
+
+            Scope(const Scope &) = delete;
+
+            Scope &operator=(const Scope &) = delete;
+
+            ~Scope() {
+                detail::current_tag = m_prev;
+            }
+        };
+
+        // 所有分组当前的计数，按 (类型, 标签) 排序
+        inline std::vector<Stats> snapshot() {
+            return detail::Registry::instance().snapshot();
+        }
+
+        // 把所有计数清零，已登记的分组保留
+        inline void reset() {
+            detail::Registry::instance().reset();
+        }
+#else
+        template<typename C>
+        void allocated(size_t) noexcept {}
+
+        template<typename C>
+        void freed(size_t) noexcept {}
+
+        template<typename C>
+        void resized(size_t, size_t) noexcept {}
+
+        template<typename C>
+        void reallocated() noexcept {}
+
+        template<typename C>
+        void moved(size_t) noexcept {}
+
+        class Scope {
+        public:
+            explicit Scope(const char *) noexcept {}
+
+            Scope(const Scope &) = delete;
+
+            Scope &operator=(const Scope &) = delete;
+        };
+
+        inline std::vector<Stats> snapshot() {
+            return {};
+        }
+
+        inline void reset() {}
+#endif
+
+        // 以 JSON 输出快照，便于接入指标系统:
+        //     {"enabled":true,"groups":[{"type":"...","tag":"","allocations":3,...},...]}
+        inline void dump_json(std::ostream &out) {
+            out << "{\"enabled\":" << (enabled ? "true" : "false") << ",\"groups\":[";
+            bool first = true;
+            for (const Stats &s: snapshot()) {
+                if (!first) out << ',';
+                first = false;
+                out << "{\"type\":";
+                detail::write_json_string(out, s.type);
+                out << ",\"tag\":";
+                detail::write_json_string(out, s.tag);
+                out << ",\"allocations\":" << s.allocations
+                    << ",\"deallocations\":" << s.deallocations
+                    << ",\"bytes_allocated\":" << s.bytes_allocated
+                    << ",\"bytes_freed\":" << s.bytes_freed
+                    << ",\"reallocations\":" << s.reallocations
+                    << ",\"bytes_moved\":" << s.bytes_moved
+                    << ",\"live_bytes\":" << s.live_bytes
+                    << ",\"peak_bytes\":" << s.peak_bytes
+                    << ",\"peak_capacity\":" << s.peak_capacity << '}';
+            }
+            out << "]}";
+        }
+
+    } // namespace instrument
+} // namespace stl
+
+#endif //STL_INSTRUMENT_HPP
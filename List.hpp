@@ -8,11 +8,14 @@
 #include <cstdint>
 #include <iterator>
 #include <initializer_list>
+#include <limits>
+#include <memory>
+#include "Instrument.hpp"
 #include "Utility.hpp"
 
 namespace stl {
 
-    template<typename T>
+    template<typename T, typename Alloc = std::allocator<T>>
     class List {
     private:
         struct ListNode {
@@ -26,6 +29,10 @@ namespace stl {
 
             ListNode(T value, ListNode *prev, ListNode *next) : m_value(value), m_prev(prev), m_next(next) {}
 
+            template<typename ...Args>
+            ListNode(ListNode *prev, ListNode *next, Args &&... args)
+                    : m_value(std::forward<Args>(args)...), m_prev(prev), m_next(next) {}
+
             ListNode(const ListNode &other)
                     : m_value(other.m_value), m_prev(other.m_prev), m_next(other.m_next) {}
 
@@ -122,9 +129,44 @@ namespace stl {
             }
         };
 
+        using node_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<ListNode>;
+        using node_traits = std::allocator_traits<node_allocator>;
+
+        node_allocator m_alloc;
         ListNode m_dummy; // 假头结点
         size_t m_size;
 
+        template<typename ...Args>
+        ListNode *create_node(ListNode *prev, ListNode *next, Args &&... args) {
+            ListNode *p = node_traits::allocate(m_alloc, 1);
+            try {
+                ::new(p) ListNode(prev, next, std::forward<Args>(args)...);
+            } catch (...) {
+                node_traits::deallocate(m_alloc, p, 1);
+                throw;
+            }
+            instrument::allocated<List>(sizeof(ListNode));
+            return p;
+        }
+
+        void destroy_node(ListNode *p) noexcept {
+            p->~ListNode();
+            node_traits::deallocate(m_alloc, p, 1);
+            instrument::freed<List>(sizeof(ListNode));
+        }
+
+        // 接管 other 的所有结点，调用前自身必须为空
+        void take(List &other) noexcept {
+            if (other.m_size == 0) return;
+            m_dummy.m_next = other.m_dummy.m_next;
+            m_dummy.m_prev = other.m_dummy.m_prev;
+            m_dummy.m_next->m_prev = &m_dummy;
+            m_dummy.m_prev->m_next = &m_dummy;
+            m_size = other.m_size;
+            other.m_dummy.m_prev = other.m_dummy.m_next = &other.m_dummy;
+            other.m_size = 0;
+        }
+
 
     public:
         using value_type = T;
@@ -135,26 +177,30 @@ namespace stl {
         using iterator = iterator;
         using const_iterator = const_iterator;
 
-        List() : m_dummy(T(), &m_dummy, &m_dummy), m_size(0) {}
+        List() : List(Alloc()) {}
 
-        explicit List(size_t n) : List(n, T()) {}
+        explicit List(const Alloc &alloc) : m_alloc(alloc), m_dummy(T(), &m_dummy, &m_dummy), m_size(0) {}
 
-        List(size_t n, const T &value) : List() {
+        explicit List(size_t n, const Alloc &alloc = Alloc()) : List(n, T(), alloc) {}
+
+        List(size_t n, const T &value, const Alloc &alloc = Alloc()) : List(alloc) {
             assign(n, value);
         }
 
-        List(List &&other) : m_dummy(other.m_dummy), m_size(other.m_size) {
-            m_dummy.m_next->m_prev = &m_dummy;
-            m_dummy.m_prev->m_next = &m_dummy;
-            other.m_dummy->m_prev = other.m_dummy->m_next = &other.m_dummy;
+        List(const List &other)
+                : List(other.begin(), other.end(),
+                       Alloc(node_traits::select_on_container_copy_construction(other.m_alloc))) {}
+
+        List(List &&other) : m_alloc(std::move(other.m_alloc)), m_dummy(T(), &m_dummy, &m_dummy), m_size(0) {
+            take(other);
         }
 
         template<typename InputIt, std::enable_if_t<is_iterator_v<InputIt>, int> = 0>
-        List(InputIt first, InputIt last) : List() {
+        List(InputIt first, InputIt last, const Alloc &alloc = Alloc()) : List(alloc) {
             assign(first, last);
         }
 
-        List(std::initializer_list<T> values) : List(values.begin(), values.end()) {}
+        List(std::initializer_list<T> values, const Alloc &alloc = Alloc()) : List(values.begin(), values.end(), alloc) {}
 
         ~List() {
             clear();
@@ -162,9 +208,9 @@ namespace stl {
 
         void clear() {
             for (ListNode *cur = m_dummy.m_next; cur != &m_dummy; --m_size) {
-                cur->m_value.~T();
-                cur = cur->m_next;
-                delete cur->m_prev;
+                ListNode *next = cur->m_next;
+                destroy_node(cur);
+                cur = next;
             }
             m_dummy.m_prev = m_dummy.m_next = &m_dummy;
         }
@@ -173,27 +219,39 @@ namespace stl {
             if (this == &other) {
                 return *this;
             }
+            if constexpr (node_traits::propagate_on_container_copy_assignment::value) {
+                if (m_alloc != other.m_alloc) {
+                    clear();
+                }
+                m_alloc = other.m_alloc;
+            }
             assign(other.begin(), other.end());
             return *this;
         }
 
-        List &operator=(List &&other) noexcept {
+        List &operator=(List &&other) noexcept(node_traits::propagate_on_container_move_assignment::value ||
+                                               node_traits::is_always_equal::value) {
             if (this == &other) {
                 return *this;
             }
             clear();
-            m_size = other.m_size;
-            m_dummy.m_next = other.m_dummy.m_next;
-            m_dummy.m_prev = other.m_dummy.m_prev;
-            m_dummy.m_next.m_prev = &m_dummy;
-            m_dummy.m_prev.m_next = &m_dummy;
-            other.m_dummy.m_prev = other.m_dummy.m_next = &other.m_dummy;
-            other.m_size = 0;
+            if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+                m_alloc = std::move(other.m_alloc);
+                take(other);
+            } else if (m_alloc == other.m_alloc) {
+                take(other);
+            } else { // 分配器不同，只能逐个移动元素
+                for (T &value : other) {
+                    emplace(end(), std::move(value));
+                }
+                other.clear();
+            }
             return *this;
         }
 
         List &operator=(std::initializer_list<T> values) {
             assign(values.begin(), values.end());
+            return *this;
         }
 
         void assign(size_t n, const T &value) {
@@ -239,18 +297,18 @@ namespace stl {
 
         template<typename ...Args, std::enable_if_t<std::is_constructible_v<T, Args&&...>, int> = 0>
         void emplace_front(Args &&... args) {
-            emplace(begin(), args...);
+            emplace(begin(), std::forward<Args>(args)...);
         }
 
         template<typename ...Args, std::enable_if_t<std::is_constructible_v<T, Args&&...>, int> = 0>
         void emplace_back(Args &&... args) {
-            emplace(end(), args...);
+            emplace(end(), std::forward<Args>(args)...);
         }
 
         template<typename ...Args, std::enable_if_t<std::is_constructible_v<T, Args&&...>, int> = 0>
         iterator emplace(const_iterator iter, Args&&... args) {
             auto prev = iter.m_cur->m_prev, next = iter.m_cur;
-            auto p = new ListNode(T(std::forward<Args>(args)...), prev, next);
+            auto p = create_node(prev, next, std::forward<Args>(args)...);
             prev->m_next = p;
             next->m_prev = p;
             ++m_size;
@@ -290,13 +348,16 @@ namespace stl {
             }
         }
 
+        // 不传播分配器时要求两者的分配器相等
         void swap(List &other) {
             if (this == &other) return;
-            std::swap(m_dummy.m_next->m_prev, other.m_dummy.m_next->m_prev);
-            std::swap(m_dummy.m_next, other.m_dummy.m_next);
-            std::swap(m_dummy.m_prev->m_next, other.m_dummy.m_prev->m_next);
-            std::swap(m_dummy.m_prev, other.m_dummy.m_prev);
-            std::swap(m_size, other.m_size);
+            if constexpr (node_traits::propagate_on_container_swap::value) {
+                std::swap(m_alloc, other.m_alloc);
+            }
+            List temp(Alloc(other.m_alloc));
+            temp.take(other);
+            other.take(*this);
+            take(temp);
         }
 
         iterator begin() {
@@ -333,7 +394,8 @@ namespace stl {
 
         template<typename InputIt, std::enable_if_t<is_iterator_v<InputIt>, int> = 0>
         iterator insert(const_iterator iter, InputIt first, InputIt last) {
-            List other(first, last);
+            List other(first, last, Alloc(m_alloc));
+            if (other.empty()) return iterator(iter.m_cur);
             iterator prev = std::prev(iter), next = iter;
             prev.m_cur->m_next = other.m_dummy.m_next;
             other.m_dummy.m_next->m_prev = prev.m_cur;
@@ -348,6 +410,39 @@ namespace stl {
             return insert(iter, values.begin(), values.end());
         }
 
+        // 把 other 的结点 [first, last) 移动到 iter 之前，不分配也不拷贝元素。
+        // 两个链表的分配器必须相等；other 可以是自身，但 iter 不能位于 [first, last) 内
+        void splice(const_iterator iter, List &other, const_iterator first, const_iterator last) {
+            if (first == last) return;
+            if (&other != this) {
+                const size_t n = std::distance(first, last);
+                other.m_size -= n;
+                m_size += n;
+            }
+            ListNode *head = first.m_cur, *tail = last.m_cur->m_prev, *pos = iter.m_cur;
+            head->m_prev->m_next = last.m_cur;
+            last.m_cur->m_prev = head->m_prev;
+            head->m_prev = pos->m_prev;
+            tail->m_next = pos;
+            pos->m_prev->m_next = head;
+            pos->m_prev = tail;
+        }
+
+        void splice(const_iterator iter, List &other, const_iterator it) {
+            const_iterator next = it;
+            ++next;
+            if (iter == it || iter == next) return;
+            splice(iter, other, it, next);
+        }
+
+        void splice(const_iterator iter, List &other) {
+            splice(iter, other, other.begin(), other.end());
+        }
+
+        void splice(const_iterator iter, List &&other) {
+            splice(iter, other);
+        }
+
         iterator erase(const_iterator iter) {
             if (iter.m_cur == &m_dummy) {
                 return end();
@@ -356,8 +451,7 @@ namespace stl {
             iterator next(cur->m_next);
             cur->m_prev->m_next = cur->m_next;
             cur->m_next->m_prev = cur->m_prev;
-            cur->m_value.~T();
-            delete cur;
+            destroy_node(cur);
             --m_size;
             return next;
         }
@@ -423,10 +517,14 @@ namespace stl {
         constexpr size_t max_size() {
             return std::numeric_limits<size_t>::max() / sizeof(ListNode);
         }
+
+        Alloc get_allocator() const {
+            return Alloc(m_alloc);
+        }
     };
 
-    template<typename T>
-    bool operator==(const List<T>& a, const List<T>& b) {
+    template<typename T, typename Alloc>
+    bool operator==(const List<T, Alloc>& a, const List<T, Alloc>& b) {
         if (&a == &b) return true;
         if (a.size() != b.size()) return false;
         for (auto p = a.begin(), q = b.begin(), end = a.end(); p != end; ++p, ++q) {
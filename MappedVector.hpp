@@ -0,0 +1,409 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#ifndef STL_MAPPEDVECTOR_HPP
+#define STL_MAPPEDVECTOR_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include "Utility.hpp"
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace stl {
+
+    enum class MapMode {
+        ReadOnly,  // 只读映射已有文件，打开时不读取数据，页面在访问时才由内核载入
+        ReadWrite, // 读写映射，文件不存在时创建
+        Truncate,  // 读写映射，并清空原有内容
+    };
+
+    namespace detail {
+        // 映射文件的头部，数据紧随其后，从第 64 字节开始
+        struct MappedHeader {
+            static constexpr char magic_value[8] = {'S', 'T', 'L', 'M', 'V', 'E', 'C', '\0'};
+            static constexpr uint32_t current_version = 1;
+
+            char magic[8];
+            uint32_t version;
+            uint32_t elem_size;
+            uint64_t size;
+            uint64_t checksum; // 数据部分 [0, size * elem_size) 的校验和，sync 时更新
+            unsigned char reserved[32];
+        };
+
+        static_assert(sizeof(MappedHeader) == 64, "mapped header must stay 64 bytes");
+
+        // 每次处理 8 个字节的 FNV-1a 变体，比逐字节计算快得多
+        inline uint64_t checksum(const void *data, size_t n) noexcept {
+            constexpr uint64_t prime = 0x100000001b3ULL;
+            const auto *p = static_cast<const unsigned char *>(data);
+            uint64_t hash = 0xcbf29ce484222325ULL ^ n;
+            for (; n >= 8; n -= 8, p += 8) {
+                uint64_t word;
+                std::memcpy(&word, p, 8);
+                hash = (hash ^ word) * prime;
+                hash ^= hash >> 29;
+            }
+            for (; n; --n, ++p) {
+                hash = (hash ^ *p) * prime;
+            }
+            return hash;
+        }
+    } // namespace detail
+
+    // 以文件为存储的 Vector，元素直接位于 mmap 映射的文件中:
+    // 只读打开是零拷贝的，读写模式下扩容通过 ftruncate 加 mremap 完成 (与 Vector 一样，扩容后指针失效)，
+    // sync() 或析构时写回元素个数和校验和。只支持可平凡拷贝的类型，文件在不同字节序的机器间不可移植
+    template<typename T>
+    class MappedVector {
+    private:
+        static_assert(std::is_trivially_copyable_v<T>, "MappedVector requires trivially copyable elements");
+        static_assert(alignof(T) <= sizeof(detail::MappedHeader), "element alignment exceeds the header size");
+
+        static constexpr size_t header_size = sizeof(detail::MappedHeader);
+
+        std::string m_path;
+        int m_fd;
+        bool m_writable;
+        unsigned char *m_base; // 映射的起点，即文件头
+        size_t m_length;       // 映射的字节数，等于文件大小
+        size_t m_size;
+
+        detail::MappedHeader *header() const noexcept {
+            return reinterpret_cast<detail::MappedHeader *>(m_base);
+        }
+
+        [[noreturn]] void fail(const char *what) const {
+            const int error = errno;
+            throw std::runtime_error(std::string("MappedVector: ") + what + " '" + m_path + "': " + std::strerror(error));
+        }
+
+        [[noreturn]] void corrupt(const char *what) const {
+            throw std::runtime_error(std::string("MappedVector: ") + what + " in '" + m_path + "'");
+        }
+
+        void require_writable() const {
+            if (!m_writable) {
+                throw std::runtime_error("MappedVector: '" + m_path + "' is opened read-only");
+            }
+        }
+
+        void unmap() noexcept {
+            if (m_base) {
+                ::munmap(m_base, m_length);
+                m_base = nullptr;
+            }
+            if (m_fd >= 0) {
+                ::close(m_fd);
+                m_fd = -1;
+            }
+        }
+
+        void open(MapMode mode) {
+            const int flags = mode == MapMode::ReadOnly ? O_RDONLY :
+                              mode == MapMode::ReadWrite ? O_RDWR | O_CREAT : O_RDWR | O_CREAT | O_TRUNC;
+            m_fd = ::open(m_path.c_str(), flags | O_CLOEXEC, 0644);
+            if (m_fd < 0) fail("cannot open");
+            struct stat st{};
+            if (::fstat(m_fd, &st) != 0) fail("cannot stat");
+            m_length = static_cast<size_t>(st.st_size);
+            const bool fresh = m_length == 0;
+            if (fresh) {
+                if (!m_writable) corrupt("missing header");
+                m_length = header_size;
+                if (::ftruncate(m_fd, static_cast<off_t>(m_length)) != 0) fail("cannot resize");
+            }
+            if (m_length < header_size) corrupt("truncated header");
+            const int prot = m_writable ? PROT_READ | PROT_WRITE : PROT_READ;
+            void *base = ::mmap(nullptr, m_length, prot, MAP_SHARED, m_fd, 0);
+            if (base == MAP_FAILED) fail("cannot map");
+            m_base = static_cast<unsigned char *>(base);
+            if (fresh) {
+                std::memset(m_base, 0, header_size);
+                std::memcpy(header()->magic, detail::MappedHeader::magic_value, sizeof(header()->magic));
+                header()->version = detail::MappedHeader::current_version;
+                header()->elem_size = sizeof(T);
+                header()->checksum = detail::checksum(nullptr, 0);
+            }
+            if (std::memcmp(header()->magic, detail::MappedHeader::magic_value, sizeof(header()->magic)) != 0) {
+                corrupt("bad magic");
+            }
+            if (header()->version != detail::MappedHeader::current_version) corrupt("unsupported version");
+            if (header()->elem_size != sizeof(T)) corrupt("element size mismatch");
+            if (header()->size > (m_length - header_size) / sizeof(T)) corrupt("element count exceeds file size");
+            m_size = header()->size;
+        }
+
+        // 把文件和映射扩大到至少能容纳 n 个元素
+        void remap(size_t n) {
+            const size_t length = header_size + n * sizeof(T);
+            if (::ftruncate(m_fd, static_cast<off_t>(length)) != 0) fail("cannot resize");
+            void *base = ::mremap(m_base, m_length, length, MREMAP_MAYMOVE);
+            if (base == MAP_FAILED) fail("cannot remap");
+            m_base = static_cast<unsigned char *>(base);
+            m_length = length;
+        }
+
+        void grow(size_t need) {
+            if (need > capacity()) {
+                remap(std::max(need, capacity() * 2));
+            }
+        }
+
+    public:
+        using value_type = T;
+        using pointer = T *;
+        using reference = T &;
+        using iterator = T *;
+        using const_pointer = const T *;
+        using const_reference = const T &;
+        using const_iterator = const T *;
+
+        inline static const char *out_of_range = "mapped vector subscript out of range";
+
+        explicit MappedVector(std::string path, MapMode mode = MapMode::ReadOnly)
+                : m_path(std::move(path)), m_fd(-1), m_writable(mode != MapMode::ReadOnly),
+                  m_base(nullptr), m_length(0), m_size(0) {
+            try {
+                open(mode);
+            } catch (...) {
+                unmap();
+                throw;
+            }
+        }
+
+        MappedVector(const MappedVector &) = delete;
+
+        MappedVector &operator=(const MappedVector &) = delete;
+
+        MappedVector(MappedVector &&other) noexcept
+                : m_path(std::move(other.m_path)), m_fd(other.m_fd), m_writable(other.m_writable),
+                  m_base(other.m_base), m_length(other.m_length), m_size(other.m_size) {
+            other.m_fd = -1;
+            other.m_base = nullptr;
+            other.m_length = other.m_size = 0;
+        }
+
+        MappedVector &operator=(MappedVector &&other) noexcept {
+            if (this != &other) {
+                close();
+                m_path = std::move(other.m_path);
+                std::swap(m_fd, other.m_fd);
+                std::swap(m_base, other.m_base);
+                m_writable = other.m_writable;
+                m_length = other.m_length;
+                m_size = other.m_size;
+                other.m_length = other.m_size = 0;
+            }
+            return *this;
+        }
+
+        ~MappedVector() {
+            close();
+        }
+
+        // 写回头部后解除映射，之后对象为空；析构时会自动调用，出错时忽略
+        void close() noexcept {
+            if (m_base && m_writable) {
+                try {
+                    sync();
+                } catch (...) {}
+            }
+            unmap();
+        }
+
+        // 更新头部的元素个数与校验和，并同步写回磁盘
+        void sync() {
+            require_writable();
+            header()->size = m_size;
+            header()->checksum = detail::checksum(data(), m_size * sizeof(T));
+            if (::msync(m_base, m_length, MS_SYNC) != 0) fail("cannot sync");
+        }
+
+        // 重新计算校验和并与头部记录的比较，会读取全部数据
+        bool verify() const noexcept {
+            return header()->size == m_size && header()->checksum == detail::checksum(data(), m_size * sizeof(T));
+        }
+
+        bool is_open() const noexcept {
+            return m_base != nullptr;
+        }
+
+        bool writable() const noexcept {
+            return m_writable;
+        }
+
+        const std::string &path() const noexcept {
+            return m_path;
+        }
+
+        T &operator[](size_t i) {
+            return data()[i];
+        }
+
+        const T &operator[](size_t i) const {
+            return data()[i];
+        }
+
+        T &at(size_t i) {
+            return const_cast<T &>(static_cast<const MappedVector &>(*this).at(i));
+        }
+
+        const T &at(size_t i) const {
+            if (i >= m_size) {
+                throw std::out_of_range(out_of_range);
+            }
+            return data()[i];
+        }
+
+        T &front() {
+            return at(0);
+        }
+
+        const T &front() const {
+            return at(0);
+        }
+
+        T &back() {
+            return at(m_size - 1);
+        }
+
+        const T &back() const {
+            return at(m_size - 1);
+        }
+
+        void push_back(const T &value) {
+            emplace_back(value);
+        }
+
+        template<typename ...Args>
+        T &emplace_back(Args &&... args) {
+            require_writable();
+            T value(std::forward<Args>(args)...); // 参数可能引用自身元素，扩容前先构造出来
+            grow(m_size + 1);
+            std::memcpy(data() + m_size, &value, sizeof(T));
+            return data()[m_size++];
+        }
+
+        void pop_back() {
+            require_writable();
+            if (m_size == 0) {
+                throw std::runtime_error("vector is empty");
+            }
+            --m_size;
+        }
+
+        // 追加 [ptr, ptr + n)，ptr 可以指向自身的元素
+        void append_n(const T *ptr, size_t n) {
+            require_writable();
+            if (n == 0) return;
+            if (m_size + n > capacity()) {
+                const bool inside = ptr >= data() && ptr < data() + m_size;
+                const size_t offset = ptr - data();
+                grow(m_size + n);
+                if (inside) ptr = data() + offset;
+            }
+            std::memmove(data() + m_size, ptr, n * sizeof(T));
+            m_size += n;
+        }
+
+        template<typename InputIt, std::enable_if_t<is_iterator_v<InputIt>, int> = 0>
+        void append_range(InputIt first, InputIt last) {
+            for (; first != last; ++first) {
+                push_back(*first);
+            }
+        }
+
+        void resize(size_t n) {
+            resize(n, T());
+        }
+
+        void resize(size_t n, const T &value) {
+            require_writable();
+            if (n > m_size) {
+                const T copy = value;
+                grow(n);
+                std::fill(data() + m_size, data() + n, copy);
+            }
+            m_size = n;
+        }
+
+        void reverse(size_t n) {
+            require_writable();
+            if (n > capacity()) {
+                remap(n);
+            }
+        }
+
+        // 把文件截断到恰好容纳现有元素
+        void shrink_to_fit() {
+            require_writable();
+            if (m_size < capacity()) {
+                const size_t length = header_size + m_size * sizeof(T);
+                void *base = ::mremap(m_base, m_length, length, 0);
+                if (base == MAP_FAILED) fail("cannot remap");
+                m_length = length;
+                if (::ftruncate(m_fd, static_cast<off_t>(length)) != 0) fail("cannot resize");
+            }
+        }
+
+        void clear() {
+            require_writable();
+            m_size = 0;
+        }
+
+        T *data() noexcept {
+            return reinterpret_cast<T *>(m_base + header_size);
+        }
+
+        const T *data() const noexcept {
+            return reinterpret_cast<const T *>(m_base + header_size);
+        }
+
+        iterator begin() {
+            return data();
+        }
+
+        iterator end() {
+            return data() + m_size;
+        }
+
+        const_iterator begin() const {
+            return data();
+        }
+
+        const_iterator end() const {
+            return data() + m_size;
+        }
+
+        size_t size() const noexcept {
+            return m_size;
+        }
+
+        size_t capacity() const noexcept {
+            return m_base ? (m_length - header_size) / sizeof(T) : 0;
+        }
+
+        bool empty() const noexcept {
+            return m_size == 0;
+        }
+    };
+
+} // namespace stl
+
+#endif
+
+#endif //STL_MAPPEDVECTOR_HPP
@@ -0,0 +1,570 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#ifndef STL_MEMORYRESOURCE_HPP
+#define STL_MEMORYRESOURCE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+
+namespace stl {
+
+    // 多态内存资源，容器通过 PolymorphicAllocator 或直接持有其指针来申请内存
+    class MemoryResource {
+    public:
+        static constexpr size_t max_align = alignof(std::max_align_t);
+
+        virtual ~MemoryResource() = default;
+
+        void *allocate(size_t bytes, size_t align = max_align) {
+            return do_allocate(bytes, align);
+        }
+
+        void deallocate(void *p, size_t bytes, size_t align = max_align) {
+            do_deallocate(p, bytes, align);
+        }
+
+        // 一个资源分配的内存能否由另一个资源释放
+        bool is_equal(const MemoryResource &other) const noexcept {
+            return this == &other || do_is_equal(other);
+        }
+
+    protected:
+        virtual void *do_allocate(size_t bytes, size_t align) = 0;
+
+        virtual void do_deallocate(void *p, size_t bytes, size_t align) = 0;
+
+        virtual bool do_is_equal(const MemoryResource &other) const noexcept {
+            return this == &other;
+        }
+    };
+
+    inline bool operator==(const MemoryResource &a, const MemoryResource &b) noexcept {
+        return a.is_equal(b);
+    }
+
+    inline bool operator!=(const MemoryResource &a, const MemoryResource &b) noexcept {
+        return !a.is_equal(b);
+    }
+
+    namespace detail {
+        class NewDeleteResource final : public MemoryResource {
+        protected:
+            void *do_allocate(size_t bytes, size_t align) override {
+                if (align > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+                    return ::operator new(bytes, std::align_val_t(align));
+                }
+                return ::operator new(bytes);
+            }
+
+            void do_deallocate(void *p, size_t bytes, size_t align) override {
+                if (align > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+                    ::operator delete(p, bytes, std::align_val_t(align));
+                } else {
+                    ::operator delete(p, bytes);
+                }
+            }
+
+            bool do_is_equal(const MemoryResource &other) const noexcept override {
+                return dynamic_cast<const NewDeleteResource *>(&other) != nullptr;
+            }
+        };
+
+        inline std::atomic<MemoryResource *> &default_resource_slot() noexcept;
+
+        inline size_t align_up(size_t n, size_t align) noexcept {
+            return (n + align - 1) & ~(align - 1);
+        }
+    } // namespace detail
+
+    // 基于全局 operator new/delete 的资源
+    inline MemoryResource *new_delete_resource() noexcept {
+        static detail::NewDeleteResource resource;
+        return &resource;
+    }
+
+    inline std::atomic<MemoryResource *> &detail::default_resource_slot() noexcept {
+        static std::atomic<MemoryResource *> slot{new_delete_resource()};
+        return slot;
+    }
+
+    // 未显式指定资源时使用的默认资源
+    inline MemoryResource *default_resource() noexcept {
+        return detail::default_resource_slot().load(std::memory_order_acquire);
+    }
+
+    // 设置默认资源，返回原来的默认资源，传入 nullptr 时恢复为 new_delete_resource()
+    inline MemoryResource *set_default_resource(MemoryResource *resource) noexcept {
+        if (resource == nullptr) resource = new_delete_resource();
+        return detail::default_resource_slot().exchange(resource, std::memory_order_acq_rel);
+    }
+
+    // 单调增长的内存池: 分配只移动指针，deallocate 不做任何事，release() 一次性归还全部内存
+    class MonotonicArena : public MemoryResource {
+    private:
+        struct Chunk {
+            Chunk *m_next;
+            size_t m_size; // 包含 Chunk 头部在内的字节数
+        };
+
+        MemoryResource *m_upstream;
+        Chunk *m_chunks;
+        char *m_cur;
+        char *m_end;
+        size_t m_next_size;
+        void *m_initial_buffer;
+        size_t m_initial_size;
+
+        static constexpr size_t default_chunk_size = 4096;
+
+        void reset_to_initial() noexcept {
+            m_cur = static_cast<char *>(m_initial_buffer);
+            m_end = m_cur + m_initial_size;
+        }
+
+        void new_chunk(size_t bytes, size_t align) {
+            const size_t need = detail::align_up(sizeof(Chunk), max_align) + bytes + align;
+            const size_t size = std::max(m_next_size, need);
+            auto *chunk = static_cast<Chunk *>(m_upstream->allocate(size, max_align));
+            chunk->m_next = m_chunks;
+            chunk->m_size = size;
+            m_chunks = chunk;
+            m_cur = reinterpret_cast<char *>(chunk) + detail::align_up(sizeof(Chunk), max_align);
+            m_end = reinterpret_cast<char *>(chunk) + size;
+            m_next_size = size * 2; // 每次向上游申请的块大小翻倍
+        }
+
+    public:
+        explicit MonotonicArena(size_t initial_size = default_chunk_size,
+                                MemoryResource *upstream = default_resource())
+                : m_upstream(upstream), m_chunks(nullptr), m_cur(nullptr), m_end(nullptr),
+                  m_next_size(std::max<size_t>(initial_size, 64)), m_initial_buffer(nullptr), m_initial_size(0) {}
+
+        // 先使用调用者提供的缓冲区 (比如栈上的数组)，用完之后再向上游申请
+        MonotonicArena(void *buffer, size_t size, MemoryResource *upstream = default_resource())
+                : m_upstream(upstream), m_chunks(nullptr), m_cur(nullptr), m_end(nullptr),
+                  m_next_size(std::max<size_t>(size * 2, default_chunk_size)),
+                  m_initial_buffer(buffer), m_initial_size(size) {
+            reset_to_initial();
+        }
+
+        MonotonicArena(const MonotonicArena &) = delete;
+
+        MonotonicArena &operator=(const MonotonicArena &) = delete;
+
+        ~MonotonicArena() override {
+            release();
+        }
+
+        // 归还所有内存，之前分配出去的指针全部失效
+        void release() noexcept {
+            while (m_chunks) {
+                Chunk *next = m_chunks->m_next;
+                m_upstream->deallocate(m_chunks, m_chunks->m_size, max_align);
+                m_chunks = next;
+            }
+            reset_to_initial();
+        }
+
+        MemoryResource *upstream() const noexcept { return m_upstream; }
+
+    protected:
+        void *do_allocate(size_t bytes, size_t align) override {
+            auto cur = reinterpret_cast<uintptr_t>(m_cur);
+            uintptr_t aligned = (cur + align - 1) & ~(uintptr_t(align) - 1);
+            if (m_cur == nullptr || aligned + bytes > reinterpret_cast<uintptr_t>(m_end)) {
+                new_chunk(bytes, align);
+                cur = reinterpret_cast<uintptr_t>(m_cur);
+                aligned = (cur + align - 1) & ~(uintptr_t(align) - 1);
+            }
+            m_cur = reinterpret_cast<char *>(aligned + bytes);
+            return reinterpret_cast<void *>(aligned);
+        }
+
+        void do_deallocate(void *, size_t, size_t) override {}
+    };
+
+    // 固定大小的内存块池: 从上游按 slab 批量申请，空闲块串成单链表
+    // 超过块大小或对齐要求的请求直接转发给上游
+    class SlabPool : public MemoryResource {
+    private:
+        struct FreeBlock {
+            FreeBlock *m_next;
+        };
+
+        struct Slab {
+            Slab *m_next;
+        };
+
+        MemoryResource *m_upstream;
+        size_t m_block_size;
+        size_t m_blocks_per_slab;
+        FreeBlock *m_free;
+        Slab *m_slabs;
+
+        size_t slab_header() const noexcept {
+            return detail::align_up(sizeof(Slab), block_align());
+        }
+
+        size_t slab_bytes() const noexcept {
+            return slab_header() + m_block_size * m_blocks_per_slab;
+        }
+
+        size_t block_align() const noexcept {
+            return std::min(m_block_size & (~m_block_size + 1), max_align); // 块大小的最低位
+        }
+
+        void new_slab() {
+            auto *slab = static_cast<Slab *>(m_upstream->allocate(slab_bytes(), max_align));
+            slab->m_next = m_slabs;
+            m_slabs = slab;
+            char *first = reinterpret_cast<char *>(slab) + slab_header();
+            for (size_t i = m_blocks_per_slab; i-- > 0;) {
+                auto *block = reinterpret_cast<FreeBlock *>(first + i * m_block_size);
+                block->m_next = m_free;
+                m_free = block;
+            }
+        }
+
+    public:
+        explicit SlabPool(size_t block_size, size_t blocks_per_slab = 256,
+                          MemoryResource *upstream = default_resource())
+                : m_upstream(upstream),
+                  m_block_size(detail::align_up(std::max(block_size, sizeof(FreeBlock)), alignof(FreeBlock))),
+                  m_blocks_per_slab(std::max<size_t>(blocks_per_slab, 1)), m_free(nullptr), m_slabs(nullptr) {}
+
+        SlabPool(const SlabPool &) = delete;
+
+        SlabPool &operator=(const SlabPool &) = delete;
+
+        ~SlabPool() override {
+            release();
+        }
+
+        void release() noexcept {
+            while (m_slabs) {
+                Slab *next = m_slabs->m_next;
+                m_upstream->deallocate(m_slabs, slab_bytes(), max_align);
+                m_slabs = next;
+            }
+            m_free = nullptr;
+        }
+
+        size_t block_size() const noexcept { return m_block_size; }
+
+        MemoryResource *upstream() const noexcept { return m_upstream; }
+
+    protected:
+        void *do_allocate(size_t bytes, size_t align) override {
+            if (bytes > m_block_size || align > block_align()) {
+                return m_upstream->allocate(bytes, align);
+            }
+            if (m_free == nullptr) {
+                new_slab();
+            }
+            FreeBlock *block = m_free;
+            m_free = block->m_next;
+            return block;
+        }
+
+        void do_deallocate(void *p, size_t bytes, size_t align) override {
+            if (bytes > m_block_size || align > block_align()) {
+                m_upstream->deallocate(p, bytes, align);
+                return;
+            }
+            auto *block = static_cast<FreeBlock *>(p);
+            block->m_next = m_free;
+            m_free = block;
+        }
+    };
+
+    // 线程本地缓存的分级内存池: 按 2 的幂划分大小等级，每个线程持有自己的空闲链表，
+    // 只有批量补充或归还空闲块时才访问加锁的中心链表，大块请求直接转发给上游
+    class ThreadLocalPool : public MemoryResource {
+    private:
+        struct FreeBlock {
+            FreeBlock *m_next;
+        };
+
+        struct Chunk {
+            Chunk *m_next;
+            size_t m_size;
+        };
+
+        static constexpr size_t min_shift = 4; // 16 字节
+        static constexpr size_t class_count = 8; // 16 ~ 2048 字节
+        static constexpr size_t batch = 32;
+        static constexpr size_t chunk_size = 64 * 1024;
+
+        struct FreeList {
+            FreeBlock *m_head = nullptr;
+            size_t m_count = 0;
+
+            void push(FreeBlock *block) noexcept {
+                block->m_next = m_head;
+                m_head = block;
+                ++m_count;
+            }
+
+            FreeBlock *pop() noexcept {
+                FreeBlock *block = m_head;
+                m_head = block->m_next;
+                --m_count;
+                return block;
+            }
+        };
+
+        // m_pool 在池销毁时置空，由 registry_mutex 保护；m_prev / m_next 串起池的所有本地缓存，由池的 m_mutex 保护
+        struct LocalCache {
+            FreeList m_lists[class_count];
+            ThreadLocalPool *m_pool = nullptr;
+            LocalCache *m_prev = nullptr;
+            LocalCache *m_next = nullptr;
+        };
+
+        // 线程退出时把仍然存活的池的空闲块归还到中心链表
+        struct ThreadCaches {
+            uint64_t m_last_id = 0;
+            LocalCache *m_last = nullptr;
+            std::unordered_map<uint64_t, std::unique_ptr<LocalCache>> m_caches;
+
+            ~ThreadCaches() {
+                std::lock_guard<std::mutex> lock(registry_mutex());
+                for (auto &entry : m_caches) {
+                    if (ThreadLocalPool *pool = entry.second->m_pool) pool->release(*entry.second);
+                }
+            }
+
+            // 丢弃已销毁的池留下的缓存，调用者需持有 registry_mutex
+            void prune() noexcept {
+                for (auto it = m_caches.begin(); it != m_caches.end();) {
+                    it = it->second->m_pool ? std::next(it) : m_caches.erase(it);
+                }
+            }
+        };
+
+        MemoryResource *m_upstream;
+        uint64_t m_id;
+        std::mutex m_mutex;
+        FreeList m_central[class_count];
+        LocalCache *m_locals; // 各线程的本地缓存
+        Chunk *m_chunks;
+        char *m_cur;
+        char *m_end;
+
+        static uint64_t next_id() noexcept {
+            static std::atomic<uint64_t> id{0};
+            return ++id;
+        }
+
+        // 线程退出与池销毁可能同时发生，两者都先持有这把锁，再决定是否访问对方
+        static std::mutex &registry_mutex() noexcept {
+            static std::mutex mutex;
+            return mutex;
+        }
+
+        static size_t size_class(size_t bytes) noexcept {
+            size_t cls = 0;
+            while ((size_t(1) << (cls + min_shift)) < bytes) ++cls;
+            return cls;
+        }
+
+        static size_t class_size(size_t cls) noexcept {
+            return size_t(1) << (cls + min_shift);
+        }
+
+        // 每个 ThreadLocalPool 都有唯一的 id。线程第一次使用某个池时登记新的缓存，并顺带丢弃已销毁的池的缓存；
+        // 线程退出时缓存中的空闲块归还给池，池销毁时只需释放 chunk
+        LocalCache &local() {
+            thread_local ThreadCaches caches;
+            if (caches.m_last_id != m_id) {
+                auto it = caches.m_caches.find(m_id);
+                if (it == caches.m_caches.end()) {
+                    std::unique_ptr<LocalCache> cache(new LocalCache());
+                    std::lock_guard<std::mutex> registry(registry_mutex());
+                    caches.prune();
+                    it = caches.m_caches.emplace(m_id, std::move(cache)).first;
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    LocalCache *local = it->second.get();
+                    local->m_pool = this;
+                    local->m_next = m_locals;
+                    if (m_locals) m_locals->m_prev = local;
+                    m_locals = local;
+                }
+                caches.m_last_id = m_id;
+                caches.m_last = it->second.get();
+            }
+            return *caches.m_last;
+        }
+
+        // 线程退出时调用，调用者需持有 registry_mutex
+        void release(LocalCache &cache) noexcept {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (size_t cls = 0; cls < class_count; ++cls) {
+                while (cache.m_lists[cls].m_head) {
+                    m_central[cls].push(cache.m_lists[cls].pop());
+                }
+            }
+            if (cache.m_prev) cache.m_prev->m_next = cache.m_next; else m_locals = cache.m_next;
+            if (cache.m_next) cache.m_next->m_prev = cache.m_prev;
+            cache.m_pool = nullptr;
+        }
+
+        // 调用者需持有 m_mutex
+        void carve(size_t cls, FreeList &list) {
+            const size_t size = class_size(cls);
+            for (size_t i = 0; i < batch; ++i) {
+                auto cur = reinterpret_cast<uintptr_t>(m_cur);
+                uintptr_t aligned = (cur + std::min(size, max_align) - 1) & ~(uintptr_t(std::min(size, max_align)) - 1);
+                if (m_cur == nullptr || aligned + size > reinterpret_cast<uintptr_t>(m_end)) {
+                    auto *chunk = static_cast<Chunk *>(m_upstream->allocate(chunk_size, max_align));
+                    chunk->m_next = m_chunks;
+                    chunk->m_size = chunk_size;
+                    m_chunks = chunk;
+                    m_cur = reinterpret_cast<char *>(chunk) + detail::align_up(sizeof(Chunk), max_align);
+                    m_end = reinterpret_cast<char *>(chunk) + chunk_size;
+                    continue;
+                }
+                m_cur = reinterpret_cast<char *>(aligned + size);
+                list.push(reinterpret_cast<FreeBlock *>(aligned));
+            }
+        }
+
+        void refill(size_t cls, FreeList &list) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            FreeList &central = m_central[cls];
+            while (central.m_head && list.m_count < batch) {
+                list.push(central.pop());
+            }
+            if (list.m_count == 0) {
+                carve(cls, list);
+            }
+        }
+
+        void flush(size_t cls, FreeList &list) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            while (list.m_count > batch) {
+                m_central[cls].push(list.pop());
+            }
+        }
+
+    public:
+        explicit ThreadLocalPool(MemoryResource *upstream = default_resource())
+                : m_upstream(upstream), m_id(next_id()), m_locals(nullptr), m_chunks(nullptr), m_cur(nullptr),
+                  m_end(nullptr) {}
+
+        ThreadLocalPool(const ThreadLocalPool &) = delete;
+
+        ThreadLocalPool &operator=(const ThreadLocalPool &) = delete;
+
+        // 销毁时所有线程都不能再使用该池；各线程的缓存只做标记，由所属线程在下次登记或退出时丢弃
+        ~ThreadLocalPool() override {
+            {
+                std::lock_guard<std::mutex> registry(registry_mutex());
+                std::lock_guard<std::mutex> lock(m_mutex);
+                for (LocalCache *local = m_locals; local; local = local->m_next) {
+                    local->m_pool = nullptr;
+                }
+                m_locals = nullptr;
+            }
+            while (m_chunks) {
+                Chunk *next = m_chunks->m_next;
+                m_upstream->deallocate(m_chunks, m_chunks->m_size, max_align);
+                m_chunks = next;
+            }
+        }
+
+        static constexpr size_t max_block_size() { return size_t(1) << (class_count - 1 + min_shift); }
+
+        MemoryResource *upstream() const noexcept { return m_upstream; }
+
+    protected:
+        void *do_allocate(size_t bytes, size_t align) override {
+            if (bytes > max_block_size() || align > max_align) {
+                return m_upstream->allocate(bytes, align);
+            }
+            const size_t cls = size_class(std::max(bytes, align));
+            FreeList &list = local().m_lists[cls];
+            if (list.m_count == 0) {
+                refill(cls, list);
+            }
+            return list.pop();
+        }
+
+        void do_deallocate(void *p, size_t bytes, size_t align) override {
+            if (bytes > max_block_size() || align > max_align) {
+                m_upstream->deallocate(p, bytes, align);
+                return;
+            }
+            const size_t cls = size_class(std::max(bytes, align));
+            FreeList &list = local().m_lists[cls];
+            list.push(static_cast<FreeBlock *>(p));
+            if (list.m_count > batch * 2) {
+                flush(cls, list);
+            }
+        }
+    };
+
+    // 以 MemoryResource 指针为状态的分配器，可用于 Vector、List 等模板容器
+    template<typename T>
+    class PolymorphicAllocator {
+    private:
+        MemoryResource *m_resource;
+
+        template<typename U>
+        friend class PolymorphicAllocator;
+
+    public:
+        using value_type = T;
+
+        // 容器拷贝、赋值和交换时不传播资源，与 std::pmr 的约定一致
+        using propagate_on_container_copy_assignment = std::false_type;
+        using propagate_on_container_move_assignment = std::false_type;
+        using propagate_on_container_swap = std::false_type;
+
+        PolymorphicAllocator() noexcept : m_resource(default_resource()) {}
+
+        PolymorphicAllocator(MemoryResource *resource) noexcept : m_resource(resource) {}
+
+        template<typename U>
+        PolymorphicAllocator(const PolymorphicAllocator<U> &other) noexcept : m_resource(other.m_resource) {}
+
+        T *allocate(size_t n) {
+            if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+                throw std::bad_array_new_length();
+            }
+            return static_cast<T *>(m_resource->allocate(n * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T *p, size_t n) {
+            m_resource->deallocate(p, n * sizeof(T), alignof(T));
+        }
+
+        PolymorphicAllocator select_on_container_copy_construction() const {
+            return PolymorphicAllocator();
+        }
+
+        MemoryResource *resource() const noexcept { return m_resource; }
+    };
+
+    template<typename T, typename U>
+    bool operator==(const PolymorphicAllocator<T> &a, const PolymorphicAllocator<U> &b) noexcept {
+        return a.resource()->is_equal(*b.resource());
+    }
+
+    template<typename T, typename U>
+    bool operator!=(const PolymorphicAllocator<T> &a, const PolymorphicAllocator<U> &b) noexcept {
+        return !(a == b);
+    }
+
+} // namespace stl
+
+#endif //STL_MEMORYRESOURCE_HPP
@@ -0,0 +1,475 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#ifndef STL_PARALLEL_HPP
+#define STL_PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <mutex>
+#include <thread>
+#include "List.hpp"
+#include "Uninitialized.hpp"
+#include "Vector.hpp"
+
+namespace stl {
+
+    // 固定数量工作线程的线程池，调用 run 的线程也会参与执行，因此嵌套调用不会死锁
+    class ThreadPool {
+    private:
+        struct Job {
+            void (*invoke)(void *, size_t);
+            void *context;
+            size_t count;
+            std::atomic<size_t> next{0};
+            size_t users = 0; // 正在执行该任务的工作线程数，受 m_mutex 保护
+            std::mutex error_mutex;
+            std::exception_ptr error;
+
+            // 不断领取下标执行，直到全部领取完
+            void work() noexcept {
+                for (size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < count;) {
+                    try {
+                        invoke(context, i);
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(error_mutex);
+                        if (!error) error = std::current_exception();
+                    }
+                }
+            }
+        };
+
+        std::mutex m_mutex;
+        std::condition_variable m_wake;
+        std::condition_variable m_finished;
+        List<Job *> m_jobs;
+        Vector<std::thread> m_threads;
+        bool m_stop = false;
+
+        void worker() {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            while (true) {
+                m_wake.wait(lock, [this] { return m_stop || !m_jobs.empty(); });
+                if (m_stop) return;
+                Job *job = m_jobs.front();
+                ++job->users;
+                lock.unlock();
+                job->work();
+                lock.lock();
+                // 下标已领取完的任务不再分给其他线程
+                if (!m_jobs.empty() && m_jobs.front() == job) {
+                    m_jobs.pop_front();
+                }
+                if (--job->users == 0) {
+                    m_finished.notify_all();
+                }
+            }
+        }
+
+    public:
+        // threads 为包括调用线程在内的并行度，0 表示使用硬件线程数
+        explicit ThreadPool(size_t threads = 0) {
+            if (threads == 0) {
+                threads = std::max(1U, std::thread::hardware_concurrency());
+            }
+            m_threads.reverse(threads - 1);
+            for (size_t i = 1; i < threads; ++i) {
+                m_threads.emplace_back([this] { worker(); });
+            }
+        }
+
+        ThreadPool(const ThreadPool &) = delete;
+
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+        ~ThreadPool() {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_wake.notify_all();
+            for (std::thread &thread : m_threads) {
+                thread.join();
+            }
+        }
+
+        size_t size() const noexcept {
+            return m_threads.size() + 1;
+        }
+
+        // 对 [0, count) 中的每个下标并行执行 f(i)，全部完成后返回，并重新抛出其中第一个异常
+        template<typename F>
+        void run(size_t count, F &&f) {
+            if (count == 0) return;
+            if (count == 1 || m_threads.empty()) {
+                for (size_t i = 0; i < count; ++i) f(i);
+                return;
+            }
+            Job job;
+            job.invoke = [](void *context, size_t i) { (*static_cast<std::remove_reference_t<F> *>(context))(i); };
+            job.context = std::addressof(f);
+            job.count = count;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_jobs.push_back(&job);
+            }
+            m_wake.notify_all();
+            job.work();
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_jobs.remove(&job);
+                m_finished.wait(lock, [&job] { return job.users == 0; });
+            }
+            if (job.error) {
+                std::rethrow_exception(job.error);
+            }
+        }
+    };
+
+    namespace detail {
+        inline std::atomic<ThreadPool *> &default_pool_slot() noexcept {
+            static std::atomic<ThreadPool *> slot{nullptr};
+            return slot;
+        }
+    } // namespace detail
+
+    // 并行算法使用的线程池，默认按硬件线程数创建
+    inline ThreadPool &default_pool() {
+        ThreadPool *pool = detail::default_pool_slot().load(std::memory_order_acquire);
+        if (pool) return *pool;
+        static ThreadPool shared;
+        return shared;
+    }
+
+    // 返回之前设置的线程池，传入 nullptr 恢复默认
+    inline ThreadPool *set_default_pool(ThreadPool *pool) noexcept {
+        return detail::default_pool_slot().exchange(pool, std::memory_order_acq_rel);
+    }
+
+    namespace parallel {
+
+        // 每个任务至少处理的元素个数，元素总数不超过 grain 时直接在当前线程顺序执行
+        inline constexpr size_t default_grain = 1 << 14;
+
+        namespace detail {
+            // 把 [0, n) 均分为 k 块时第 c 块的起点
+            inline size_t chunk_begin(size_t n, size_t k, size_t c) noexcept {
+                return n / k * c + std::min(c, n % k);
+            }
+
+            // 每块不少于 grain 个元素，块数不超过线程数的 4 倍以便负载均衡
+            inline size_t chunk_count(size_t n, size_t grain, size_t threads) noexcept {
+                grain = std::max<size_t>(grain, 1);
+                if (n <= grain || threads == 1) return 1;
+                return std::min((n + grain - 1) / grain, threads * 4);
+            }
+
+            // 把 [0, n) 切块后并行执行 f(c, begin, end)
+            template<typename F>
+            void for_each_chunk(size_t k, size_t n, F &&f) {
+                default_pool().run(k, [&](size_t c) {
+                    f(c, chunk_begin(n, k, c), chunk_begin(n, k, c + 1));
+                });
+            }
+
+            // 暂存元素的未初始化缓冲区，构造时把区间中的元素移入
+            template<typename T>
+            class Buffer {
+            private:
+                T *m_data;
+                size_t m_size;
+
+            public:
+                template<typename RandomIt>
+                Buffer(RandomIt first, size_t n) : m_data(std::allocator<T>().allocate(n)), m_size(0) {
+                    if constexpr (std::is_nothrow_move_constructible_v<T>) {
+                        const size_t k = chunk_count(n, default_grain, default_pool().size());
+                        for_each_chunk(k, n, [&](size_t, size_t begin, size_t end) {
+                            for (size_t i = begin; i < end; ++i) {
+                                ::new(m_data + i) T(std::move(first[i]));
+                            }
+                        });
+                        m_size = n;
+                    } else {
+                        try {
+                            for (; m_size < n; ++m_size) {
+                                ::new(m_data + m_size) T(std::move(first[m_size]));
+                            }
+                        } catch (...) {
+                            stl::destroy(m_data, m_data + m_size);
+                            std::allocator<T>().deallocate(m_data, n);
+                            throw;
+                        }
+                    }
+                }
+
+                Buffer(const Buffer &) = delete;
+
+                Buffer &operator=(const Buffer &) = delete;
+
+                ~Buffer() {
+                    stl::destroy(m_data, m_data + m_size);
+                    std::allocator<T>().deallocate(m_data, m_size);
+                }
+
+                T *data() noexcept {
+                    return m_data;
+                }
+            };
+
+            // 稳定归并 a[0, n) 与 b[0, m) 时，输出的前 k 个元素中来自 a 的个数
+            template<typename It, typename Compare>
+            size_t co_rank(size_t k, It a, size_t n, It b, size_t m, Compare &comp) {
+                size_t lo = k > m ? k - m : 0, hi = std::min(k, n);
+                while (lo < hi) {
+                    const size_t i = lo + (hi - lo) / 2;
+                    if (!comp(b[k - i - 1], a[i])) {
+                        lo = i + 1;
+                    } else {
+                        hi = i;
+                    }
+                }
+                return lo;
+            }
+
+            struct MergeTask {
+                size_t first, middle;      // 待归并的两个相邻有序段 [first, middle) 与 [middle, last)
+                size_t out_begin, out_end; // 本任务负责的输出区间，相对于 first
+                size_t a_begin, a_end;     // 对应的第一段中的区间，相对于 first
+            };
+
+            // 稳定归并，只把选中的元素移动到 out。std::merge 配合 move_iterator 会以右值调用 comp，
+            // 按值接收参数的比较函数会在比较时把元素移走
+            template<typename InputIt, typename OutputIt, typename Compare>
+            OutputIt move_merge(InputIt first1, InputIt last1, InputIt first2, InputIt last2, OutputIt out,
+                                Compare &comp) {
+                for (; first1 != last1 && first2 != last2; ++out) {
+                    if (comp(*first2, *first1)) {
+                        *out = std::move(*first2);
+                        ++first2;
+                    } else {
+                        *out = std::move(*first1);
+                        ++first1;
+                    }
+                }
+                out = std::move(first1, last1, out);
+                return std::move(first2, last2, out);
+            }
+
+            // 两两归并 src 中的有序段并写入 dst，每次归并按输出位置切分成多个任务并行执行；
+            // 切分点必须在归并开始前求出，否则会读到其他任务已经移走的元素
+            template<typename Src, typename Dst, typename Compare>
+            void merge_round(Src src, Dst dst, Vector<size_t> &runs, size_t piece, Compare &comp) {
+                Vector<MergeTask> tasks;
+                Vector<size_t> next;
+                for (size_t r = 0; r + 1 < runs.size(); r += 2) {
+                    const size_t first = runs[r];
+                    const size_t middle = runs[r + 1];
+                    const size_t last = r + 2 < runs.size() ? runs[r + 2] : middle;
+                    const size_t len = last - first, parts = std::max<size_t>(1, len / piece);
+                    size_t a_begin = 0;
+                    for (size_t p = 0; p < parts; ++p) {
+                        const size_t out_begin = chunk_begin(len, parts, p), out_end = chunk_begin(len, parts, p + 1);
+                        const size_t a_end = co_rank(out_end, src + first, middle - first, src + middle, last - middle, comp);
+                        tasks.push_back({first, middle, out_begin, out_end, a_begin, a_end});
+                        a_begin = a_end;
+                    }
+                    next.push_back(first);
+                }
+                next.push_back(runs.back());
+                default_pool().run(tasks.size(), [&](size_t t) {
+                    const MergeTask &task = tasks[t];
+                    const auto a = src + task.first, b = src + task.middle;
+                    move_merge(a + task.a_begin, a + task.a_end, b + (task.out_begin - task.a_begin),
+                               b + (task.out_end - task.a_end), dst + task.first + task.out_begin, comp);
+                });
+                runs = std::move(next);
+            }
+
+            // 各线程先排序一段，再逐轮两两归并，归并是稳定的
+            template<typename RandomIt, typename Compare, typename Sort>
+            void merge_sort(RandomIt first, RandomIt last, Compare comp, size_t grain, Sort sort) {
+                using T = typename std::iterator_traits<RandomIt>::value_type;
+                const size_t n = last - first, threads = default_pool().size();
+                grain = std::max<size_t>(grain, 1);
+                const size_t k = n <= grain ? 1 : std::min((n + grain - 1) / grain, threads);
+                if (k == 1) {
+                    sort(first, last, comp);
+                    return;
+                }
+                Buffer<T> buffer(first, n);
+                T *const temp = buffer.data();
+                Vector<size_t> runs;
+                for (size_t c = 0; c <= k; ++c) {
+                    runs.push_back(chunk_begin(n, k, c));
+                }
+                default_pool().run(k, [&](size_t c) {
+                    sort(temp + runs[c], temp + runs[c + 1], comp);
+                });
+                const size_t piece = std::max(grain, n / threads);
+                bool in_buffer = true;
+                while (runs.size() > 2) {
+                    if (in_buffer) {
+                        merge_round(temp, first, runs, piece, comp);
+                    } else {
+                        merge_round(first, temp, runs, piece, comp);
+                    }
+                    in_buffer = !in_buffer;
+                }
+                if (in_buffer) {
+                    for_each_chunk(chunk_count(n, grain, threads), n, [&](size_t, size_t begin, size_t end) {
+                        std::move(temp + begin, temp + end, first + begin);
+                    });
+                }
+            }
+        } // namespace detail
+
+        template<typename RandomIt, typename UnaryFunction>
+        void for_each(RandomIt first, RandomIt last, UnaryFunction f, size_t grain = default_grain) {
+            const size_t n = last - first;
+            const size_t k = detail::chunk_count(n, grain, default_pool().size());
+            detail::for_each_chunk(k, n, [&](size_t, size_t begin, size_t end) {
+                std::for_each(first + begin, first + end, f);
+            });
+        }
+
+        // out 可以与 first 相同
+        template<typename RandomIt, typename OutputIt, typename UnaryOp>
+        OutputIt transform(RandomIt first, RandomIt last, OutputIt out, UnaryOp op, size_t grain = default_grain) {
+            const size_t n = last - first;
+            const size_t k = detail::chunk_count(n, grain, default_pool().size());
+            detail::for_each_chunk(k, n, [&](size_t, size_t begin, size_t end) {
+                std::transform(first + begin, first + end, out + begin, op);
+            });
+            return out + n;
+        }
+
+        template<typename RandomIt1, typename RandomIt2, typename OutputIt, typename BinaryOp,
+                std::enable_if_t<is_iterator_v<OutputIt>, int> = 0>
+        OutputIt transform(RandomIt1 first1, RandomIt1 last1, RandomIt2 first2, OutputIt out, BinaryOp op,
+                           size_t grain = default_grain) {
+            const size_t n = last1 - first1;
+            const size_t k = detail::chunk_count(n, grain, default_pool().size());
+            detail::for_each_chunk(k, n, [&](size_t, size_t begin, size_t end) {
+                std::transform(first1 + begin, first1 + end, first2 + begin, out + begin, op);
+            });
+            return out + n;
+        }
+
+        // op 需满足结合律，各块的部分结果按顺序合并，因此不要求交换律
+        template<typename RandomIt, typename T, typename BinaryOp = std::plus<>>
+        T reduce(RandomIt first, RandomIt last, T init, BinaryOp op = BinaryOp(), size_t grain = default_grain) {
+            const size_t n = last - first;
+            const size_t k = detail::chunk_count(n, grain, default_pool().size());
+            if (k == 1) {
+                for (; first != last; ++first) init = op(std::move(init), *first);
+                return init;
+            }
+            Vector<T> partials(k, init);
+            detail::for_each_chunk(k, n, [&](size_t c, size_t begin, size_t end) {
+                T acc = first[begin];
+                for (size_t i = begin + 1; i < end; ++i) acc = op(std::move(acc), first[i]);
+                partials[c] = std::move(acc);
+            });
+            for (T &partial : partials) {
+                init = op(std::move(init), std::move(partial));
+            }
+            return init;
+        }
+
+        // 先并行求出每块的和，再顺序求块间前缀，最后各块带着前缀并行扫描；out 可以与 first 相同
+        template<typename RandomIt, typename OutputIt, typename BinaryOp = std::plus<>>
+        OutputIt inclusive_scan(RandomIt first, RandomIt last, OutputIt out, BinaryOp op = BinaryOp(),
+                                size_t grain = default_grain) {
+            using T = typename std::iterator_traits<RandomIt>::value_type;
+            const size_t n = last - first;
+            const size_t k = detail::chunk_count(n, grain, default_pool().size());
+            if (k == 1) {
+                return std::partial_sum(first, last, out, op);
+            }
+            Vector<T> sums(k, first[0]);
+            // 最后一块的和用不到
+            default_pool().run(k - 1, [&](size_t c) {
+                const size_t begin = detail::chunk_begin(n, k, c), end = detail::chunk_begin(n, k, c + 1);
+                T acc = first[begin];
+                for (size_t i = begin + 1; i < end; ++i) acc = op(std::move(acc), first[i]);
+                sums[c] = std::move(acc);
+            });
+            for (size_t c = 1; c < k; ++c) {
+                sums[c] = op(sums[c - 1], std::move(sums[c]));
+            }
+            detail::for_each_chunk(k, n, [&](size_t c, size_t begin, size_t end) {
+                if (c == 0) {
+                    std::partial_sum(first + begin, first + end, out + begin, op);
+                    return;
+                }
+                T acc = sums[c - 1];
+                for (size_t i = begin; i < end; ++i) {
+                    acc = op(std::move(acc), first[i]);
+                    out[i] = acc;
+                }
+            });
+            return out + n;
+        }
+
+        template<typename RandomIt, typename Compare = std::less<>>
+        void sort(RandomIt first, RandomIt last, Compare comp = Compare(), size_t grain = default_grain) {
+            detail::merge_sort(first, last, comp, grain, [](auto begin, auto end, Compare &comp) {
+                std::sort(begin, end, comp);
+            });
+        }
+
+        template<typename RandomIt, typename Compare = std::less<>>
+        void stable_sort(RandomIt first, RandomIt last, Compare comp = Compare(), size_t grain = default_grain) {
+            detail::merge_sort(first, last, comp, grain, [](auto begin, auto end, Compare &comp) {
+                std::stable_sort(begin, end, comp);
+            });
+        }
+
+        // 稳定划分，返回第一个不满足 pred 的位置；pred 会对每个元素调用两次，必须没有副作用
+        template<typename RandomIt, typename UnaryPredicate>
+        RandomIt partition(RandomIt first, RandomIt last, UnaryPredicate pred, size_t grain = default_grain) {
+            using T = typename std::iterator_traits<RandomIt>::value_type;
+            const size_t n = last - first;
+            const size_t k = detail::chunk_count(n, grain, default_pool().size());
+            if (k == 1) {
+                return std::stable_partition(first, last, pred);
+            }
+            Vector<size_t> counts(k);
+            detail::for_each_chunk(k, n, [&](size_t c, size_t begin, size_t end) {
+                counts[c] = std::count_if(first + begin, first + end, pred);
+            });
+            // counts[c] 改为第 c 块中满足 pred 的元素的写入位置
+            size_t total = 0;
+            for (size_t &count : counts) {
+                const size_t cur = count;
+                count = total;
+                total += cur;
+            }
+            detail::Buffer<T> buffer(first, n);
+            T *const temp = buffer.data();
+            detail::for_each_chunk(k, n, [&](size_t c, size_t begin, size_t end) {
+                size_t yes = counts[c], no = total + begin - counts[c];
+                for (size_t i = begin; i < end; ++i) {
+                    if (pred(temp[i])) {
+                        first[yes++] = std::move(temp[i]);
+                    } else {
+                        first[no++] = std::move(temp[i]);
+                    }
+                }
+            });
+            return first + total;
+        }
+
+    } // namespace parallel
+
+} // namespace stl
+
+#endif //STL_PARALLEL_HPP
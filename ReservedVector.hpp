@@ -0,0 +1,152 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#ifndef STL_RESERVEDVECTOR_HPP
+#define STL_RESERVEDVECTOR_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include "Vector.hpp"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace stl {
+
+    // 预先保留一大段虚拟地址空间 (PROT_NONE，不占物理内存)，扩容时只把后续的页改为可读写，
+    // 因此只要容量不超过预留的大小，元素就不会被搬动，迭代器和引用始终有效。
+    // 超过预留大小时 Vector 会退回到申请新内存再搬运的做法，新映射的大小恰好等于所需容量
+    template<typename T>
+    class ReservedAllocator {
+    private:
+        template<typename U>
+        friend class ReservedAllocator;
+
+        static constexpr size_t huge_page = size_t(2) << 20;
+
+        size_t m_reserve; // 每次 allocate 预留的字节数
+        bool m_huge;      // 是否建议内核使用透明大页
+
+        static size_t page_size() noexcept {
+            static const size_t size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+            return size;
+        }
+
+        static size_t round_up(size_t bytes, size_t align) noexcept {
+            return (bytes + align - 1) & ~(align - 1);
+        }
+
+        static size_t bytes(size_t n) noexcept {
+            return round_up(n * sizeof(T), page_size());
+        }
+
+        // 容量为 n 的内存块所在映射的大小
+        size_t mapping_size(size_t n) const noexcept {
+            return std::max(m_reserve, bytes(n));
+        }
+
+        // 使用大页时把映射的起点对齐到 2 MiB，否则内核无法用大页覆盖开头的部分
+        void *map(size_t size) const noexcept {
+            const int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE;
+            if (!m_huge) {
+                void *p = ::mmap(nullptr, size, PROT_NONE, flags, -1, 0);
+                return p == MAP_FAILED ? nullptr : p;
+            }
+            void *raw = ::mmap(nullptr, size + huge_page, PROT_NONE, flags, -1, 0);
+            if (raw == MAP_FAILED) return nullptr;
+            char *begin = static_cast<char *>(raw);
+            char *aligned = reinterpret_cast<char *>(round_up(reinterpret_cast<uintptr_t>(begin), huge_page));
+            if (aligned != begin) {
+                ::munmap(begin, aligned - begin);
+            }
+            if (const size_t tail = begin + size + huge_page - (aligned + size)) {
+                ::munmap(aligned + size, tail);
+            }
+            ::madvise(aligned, size, MADV_HUGEPAGE);
+            return aligned;
+        }
+
+        static bool commit(T *p, size_t from, size_t to) noexcept {
+            return to <= from || ::mprotect(reinterpret_cast<char *>(p) + from, to - from, PROT_READ | PROT_WRITE) == 0;
+        }
+
+    public:
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+        using is_always_equal = std::false_type;
+
+        static constexpr size_t default_reserve = size_t(1) << 36; // 64 GiB
+
+        explicit ReservedAllocator(size_t reserve = default_reserve, bool huge_pages = false) noexcept
+                : m_reserve(round_up(std::max<size_t>(reserve, 1), huge_pages ? huge_page : page_size())),
+                  m_huge(huge_pages) {}
+
+        template<typename U>
+        ReservedAllocator(const ReservedAllocator<U> &other) noexcept
+                : m_reserve(other.m_reserve), m_huge(other.m_huge) {}
+
+        T *allocate(size_t n) {
+            const size_t size = mapping_size(n);
+            T *p = static_cast<T *>(map(size));
+            if (p == nullptr) throw std::bad_alloc();
+            if (!commit(p, 0, bytes(n))) {
+                ::munmap(p, size);
+                throw std::bad_alloc();
+            }
+            return p;
+        }
+
+        void deallocate(T *p, size_t n) noexcept {
+            ::munmap(p, mapping_size(n));
+        }
+
+        bool expand(T *p, size_t old_n, size_t new_n) noexcept {
+            return bytes(new_n) <= mapping_size(old_n) && commit(p, bytes(old_n), bytes(new_n));
+        }
+
+        // 把多余的页交还给内核并重新设为不可访问，地址空间仍然保留以便再次扩容
+        bool shrink(T *p, size_t old_n, size_t new_n) noexcept {
+            if (bytes(old_n) > m_reserve) return false; // 超出预留大小的映射在释放时需要原来的容量
+            const size_t from = bytes(new_n), to = bytes(old_n);
+            if (from < to) {
+                char *tail = reinterpret_cast<char *>(p) + from;
+                ::madvise(tail, to - from, MADV_DONTNEED);
+                ::mprotect(tail, to - from, PROT_NONE);
+            }
+            return true;
+        }
+
+        size_t reserve_bytes() const noexcept {
+            return m_reserve;
+        }
+
+        bool huge_pages() const noexcept {
+            return m_huge;
+        }
+
+        // 预留大小相同的两个分配器可以互相释放对方的内存
+        template<typename U>
+        bool operator==(const ReservedAllocator<U> &other) const noexcept {
+            return m_reserve == other.m_reserve;
+        }
+
+        template<typename U>
+        bool operator!=(const ReservedAllocator<U> &other) const noexcept {
+            return m_reserve != other.m_reserve;
+        }
+    };
+
+    // 接口与 Vector 完全相同，构造时传入分配器指定预留大小和是否使用大页:
+    //     ReservedVector<int> v(ReservedAllocator<int>(size_t(1) << 34, true));
+    template<typename T, typename Growth = DoublingGrowth>
+    using ReservedVector = Vector<T, ReservedAllocator<T>, Growth>;
+
+} // namespace stl
+
+#endif
+
+#endif //STL_RESERVEDVECTOR_HPP
@@ -0,0 +1,563 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#ifndef STL_RINGBUFFER_HPP
+#define STL_RINGBUFFER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "Instrument.hpp"
+#include "Uninitialized.hpp"
+
+namespace stl {
+
+    // 环形缓冲区满了之后的行为
+    enum class RingPolicy {
+        Grow,      // 容量翻倍 (默认)
+        Reject,    // 固定容量，push 抛出异常，try_push 返回 false
+        Overwrite, // 固定容量，丢弃另一端最旧的元素
+    };
+
+    namespace detail {
+        inline size_t ceil_pow2(size_t n) noexcept {
+            return n <= 1 ? 1 : size_t(1) << (64 - __builtin_clzll(n - 1));
+        }
+
+        // 通过下标访问元素的随机访问迭代器，Owner 需要提供 operator[]
+        template<typename Owner, typename T, bool Const>
+        class IndexIterator {
+        private:
+            template<typename, typename, bool>
+            friend class IndexIterator;
+
+            using owner = std::conditional_t<Const, const Owner, Owner>;
+
+            owner *m_owner;
+            size_t m_index;
+
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = T;
+            using difference_type = ptrdiff_t;
+            using pointer = std::conditional_t<Const, const T *, T *>;
+            using reference = std::conditional_t<Const, const T &, T &>;
+
+            IndexIterator() : m_owner(nullptr), m_index(0) {}
+
+            IndexIterator(owner *o, size_t index) : m_owner(o), m_index(index) {}
+
+            // iterator 可以隐式转换为 const_iterator
+            template<bool C = Const, std::enable_if_t<C, int> = 0>
+            IndexIterator(const IndexIterator<Owner, T, false> &other) : m_owner(other.m_owner), m_index(other.m_index) {}
+
+            size_t index() const noexcept {
+                return m_index;
+            }
+
+            reference operator*() const {
+                return (*m_owner)[m_index];
+            }
+
+            pointer operator->() const {
+                return &(*m_owner)[m_index];
+            }
+
+            reference operator[](difference_type n) const {
+                return (*m_owner)[m_index + n];
+            }
+
+            IndexIterator &operator++() {
+                ++m_index;
+                return *this;
+            }
+
+            IndexIterator &operator--() {
+                --m_index;
+                return *this;
+            }
+
+            IndexIterator operator++(int) {
+                IndexIterator temp = *this;
+                ++m_index;
+                return temp;
+            }
+
+            IndexIterator operator--(int) {
+                IndexIterator temp = *this;
+                --m_index;
+                return temp;
+            }
+
+            IndexIterator &operator+=(difference_type n) {
+                m_index += n;
+                return *this;
+            }
+
+            IndexIterator &operator-=(difference_type n) {
+                m_index -= n;
+                return *this;
+            }
+
+            IndexIterator operator+(difference_type n) const {
+                return IndexIterator(m_owner, m_index + n);
+            }
+
+            friend IndexIterator operator+(difference_type n, const IndexIterator &iter) {
+                return iter + n;
+            }
+
+            IndexIterator operator-(difference_type n) const {
+                return IndexIterator(m_owner, m_index - n);
+            }
+
+            difference_type operator-(const IndexIterator &other) const {
+                return static_cast<difference_type>(m_index - other.m_index);
+            }
+
+            bool operator==(const IndexIterator &other) const {
+                return m_index == other.m_index;
+            }
+
+            bool operator!=(const IndexIterator &other) const {
+                return m_index != other.m_index;
+            }
+
+            bool operator<(const IndexIterator &other) const {
+                return m_index < other.m_index;
+            }
+
+            bool operator>(const IndexIterator &other) const {
+                return m_index > other.m_index;
+            }
+
+            bool operator<=(const IndexIterator &other) const {
+                return m_index <= other.m_index;
+            }
+
+            bool operator>=(const IndexIterator &other) const {
+                return m_index >= other.m_index;
+            }
+        };
+    } // namespace detail
+
+    // 容量为 2 的幂的环形缓冲区，两端插入删除都是 O(1)，下标通过掩码换算而不是取模。
+    // 固定容量的模式 (Reject/Overwrite) 在构造时一次性分配，之后不再分配内存；
+    // 此时 capacity() 为构造时指定的值，底层存储向上取整到 2 的幂
+    template<typename T, typename Alloc = std::allocator<T>>
+    class RingBuffer : private Alloc {
+    private:
+        using alloc_traits = std::allocator_traits<Alloc>;
+
+        T *m_data;
+        size_t m_capacity; // 底层存储的大小，0 或 2 的幂
+        size_t m_head;     // 第一个元素所在的位置
+        size_t m_size;
+        size_t m_limit;    // 固定容量模式下的元素上限
+        RingPolicy m_policy;
+
+        Alloc &alloc() noexcept {
+            return *this;
+        }
+
+        const Alloc &alloc() const noexcept {
+            return *this;
+        }
+
+        T *allocate(size_t n) {
+            T *p = alloc_traits::allocate(alloc(), n);
+            instrument::allocated<RingBuffer>(n * sizeof(T));
+            return p;
+        }
+
+        void deallocate(T *p, size_t n) noexcept {
+            instrument::freed<RingBuffer>(n * sizeof(T));
+            alloc_traits::deallocate(alloc(), p, n);
+        }
+
+        T *slot(size_t i) const noexcept {
+            return m_data + ((m_head + i) & (m_capacity - 1));
+        }
+
+        bool bounded() const noexcept {
+            return m_policy != RingPolicy::Grow;
+        }
+
+        // 把元素按逻辑顺序搬到容量为 new_capacity 的新内存中，抛出异常时保持不变
+        void reallocate(size_t new_capacity) {
+            T *new_data = allocate(new_capacity);
+            const size_t first = std::min(m_size, m_capacity - m_head); // [m_head, m_capacity) 段的元素个数
+            if (m_size) {
+                if constexpr (is_nothrow_relocatable_v<T>) {
+                    relocate(m_data + m_head, first, new_data);
+                    relocate(m_data, m_size - first, new_data + first);
+                } else {
+                    try {
+                        uninitialized_move_if_noexcept(m_data + m_head, first, new_data);
+                        try {
+                            uninitialized_move_if_noexcept(m_data, m_size - first, new_data + first);
+                        } catch (...) {
+                            destroy(new_data, new_data + first);
+                            throw;
+                        }
+                    } catch (...) {
+                        deallocate(new_data, new_capacity);
+                        throw;
+                    }
+                    destroy(m_data + m_head, m_data + m_head + first);
+                    destroy(m_data, m_data + m_size - first);
+                }
+                instrument::reallocated<RingBuffer>();
+                instrument::moved<RingBuffer>(m_size * sizeof(T));
+            }
+            if (m_data) deallocate(m_data, m_capacity);
+            m_data = new_data;
+            m_capacity = new_capacity;
+            m_head = 0;
+        }
+
+        void free() noexcept {
+            clear();
+            if (m_data) deallocate(m_data, m_capacity);
+            m_data = nullptr;
+            m_capacity = m_head = 0;
+        }
+
+        // 已满时按策略腾出位置，返回 false 表示拒绝插入；参数可能引用自身元素，由调用者先构造出来
+        template<bool Back>
+        bool make_room() {
+            if (bounded() ? m_size < m_limit : m_size < m_capacity) return true;
+            switch (m_policy) {
+                case RingPolicy::Grow:
+                    reallocate(std::max<size_t>(m_capacity * 2, 8));
+                    return true;
+                case RingPolicy::Reject:
+                    return false;
+                case RingPolicy::Overwrite:
+                    if (m_limit == 0) return false;
+                    if constexpr (Back) {
+                        pop_front();
+                    } else {
+                        pop_back();
+                    }
+                    return true;
+            }
+            return false;
+        }
+
+        template<typename ...Args>
+        bool place_back(Args &&... args) {
+            if (!(bounded() ? m_size < m_limit : m_size < m_capacity)) {
+                T value(std::forward<Args>(args)...);
+                if (!make_room<true>()) return false;
+                ::new(slot(m_size)) T(std::move(value));
+            } else {
+                ::new(slot(m_size)) T(std::forward<Args>(args)...);
+            }
+            ++m_size;
+            return true;
+        }
+
+        template<typename ...Args>
+        bool place_front(Args &&... args) {
+            if (!(bounded() ? m_size < m_limit : m_size < m_capacity)) {
+                T value(std::forward<Args>(args)...);
+                if (!make_room<false>()) return false;
+                ::new(m_data + ((m_head - 1) & (m_capacity - 1))) T(std::move(value));
+            } else {
+                ::new(m_data + ((m_head - 1) & (m_capacity - 1))) T(std::forward<Args>(args)...);
+            }
+            m_head = (m_head - 1) & (m_capacity - 1);
+            ++m_size;
+            return true;
+        }
+
+        // 按 other 的策略和容量逐个复制（右值时移动）元素，要求自身为空且没有内存
+        template<typename Ring>
+        void clone(Ring &&other) {
+            using source = std::conditional_t<std::is_lvalue_reference_v<Ring>, const T &, T &&>;
+            m_policy = other.m_policy;
+            m_limit = other.m_limit;
+            if (other.m_capacity) {
+                reallocate(other.m_capacity);
+                for (size_t i = 0; i < other.m_size; ++i) {
+                    ::new(slot(m_size)) T(static_cast<source>(*other.slot(i)));
+                    ++m_size;
+                }
+            }
+        }
+
+    public:
+        using allocator_type = Alloc;
+        using value_type = T;
+        using reference = T &;
+        using const_reference = const T &;
+        using iterator = detail::IndexIterator<RingBuffer, T, false>;
+        using const_iterator = detail::IndexIterator<RingBuffer, T, true>;
+
+        inline static const char *out_of_range = "ring buffer subscript out of range";
+
+        RingBuffer() noexcept(std::is_nothrow_default_constructible_v<Alloc>) : RingBuffer(Alloc()) {}
+
+        explicit RingBuffer(const Alloc &alloc) noexcept
+                : Alloc(alloc), m_data(nullptr), m_capacity(0), m_head(0), m_size(0), m_limit(0),
+                  m_policy(RingPolicy::Grow) {}
+
+        // Grow 策略下 capacity 只是预留，Reject/Overwrite 策略下是元素个数的上限
+        explicit RingBuffer(size_t capacity, RingPolicy policy = RingPolicy::Grow, const Alloc &alloc = Alloc())
+                : RingBuffer(alloc) {
+            m_policy = policy;
+            m_limit = bounded() ? capacity : 0;
+            if (capacity) reallocate(detail::ceil_pow2(capacity));
+        }
+
+        RingBuffer(const RingBuffer &other)
+                : RingBuffer(alloc_traits::select_on_container_copy_construction(other.alloc())) {
+            clone(other);
+        }
+
+        RingBuffer(RingBuffer &&other) noexcept
+                : Alloc(std::move(other.alloc())), m_data(other.m_data), m_capacity(other.m_capacity),
+                  m_head(other.m_head), m_size(other.m_size), m_limit(other.m_limit), m_policy(other.m_policy) {
+            other.m_data = nullptr;
+            other.m_capacity = other.m_head = other.m_size = 0;
+        }
+
+        ~RingBuffer() {
+            free();
+        }
+
+        RingBuffer &operator=(const RingBuffer &other) {
+            if (this == &other) return *this;
+            if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+                if (alloc() != other.alloc()) { // 旧内存必须由旧分配器释放
+                    free();
+                }
+                alloc() = other.alloc();
+            }
+            // 临时对象使用自身的分配器，swap 不交换分配器时内存也不会错配
+            RingBuffer temp(alloc());
+            temp.clone(other);
+            swap(temp);
+            return *this;
+        }
+
+        RingBuffer &operator=(RingBuffer &&other) noexcept(alloc_traits::propagate_on_container_move_assignment::value ||
+                                                           alloc_traits::is_always_equal::value) {
+            if (this == &other) return *this;
+            if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+                free();
+                alloc() = std::move(other.alloc());
+            } else if (alloc() != other.alloc()) { // 分配器不同，只能逐个移动元素
+                RingBuffer temp(alloc());
+                temp.clone(std::move(other));
+                swap(temp);
+                other.clear();
+                return *this;
+            } else {
+                free();
+            }
+            swap(other);
+            return *this;
+        }
+
+        void swap(RingBuffer &other) noexcept {
+            using std::swap;
+            if constexpr (alloc_traits::propagate_on_container_swap::value) {
+                swap(alloc(), other.alloc());
+            }
+            swap(m_data, other.m_data);
+            swap(m_capacity, other.m_capacity);
+            swap(m_head, other.m_head);
+            swap(m_size, other.m_size);
+            swap(m_limit, other.m_limit);
+            swap(m_policy, other.m_policy);
+        }
+
+        template<typename ...Args>
+        T &emplace_back(Args &&... args) {
+            if (!place_back(std::forward<Args>(args)...)) {
+                throw std::runtime_error("ring buffer is full");
+            }
+            return back();
+        }
+
+        template<typename ...Args>
+        T &emplace_front(Args &&... args) {
+            if (!place_front(std::forward<Args>(args)...)) {
+                throw std::runtime_error("ring buffer is full");
+            }
+            return front();
+        }
+
+        void push_back(const T &value) {
+            emplace_back(value);
+        }
+
+        void push_back(T &&value) {
+            emplace_back(std::move(value));
+        }
+
+        void push_front(const T &value) {
+            emplace_front(value);
+        }
+
+        void push_front(T &&value) {
+            emplace_front(std::move(value));
+        }
+
+        // Reject 策略下已满时返回 false，其余情况与 emplace_back 相同
+        template<typename ...Args>
+        bool try_emplace_back(Args &&... args) {
+            return place_back(std::forward<Args>(args)...);
+        }
+
+        bool try_push_back(const T &value) {
+            return place_back(value);
+        }
+
+        bool try_push_back(T &&value) {
+            return place_back(std::move(value));
+        }
+
+        void pop_front() {
+            if (m_size == 0) {
+                throw std::runtime_error("ring buffer is empty");
+            }
+            m_data[m_head].~T();
+            m_head = (m_head + 1) & (m_capacity - 1);
+            --m_size;
+        }
+
+        void pop_back() {
+            if (m_size == 0) {
+                throw std::runtime_error("ring buffer is empty");
+            }
+            --m_size;
+            slot(m_size)->~T();
+        }
+
+        T &operator[](size_t i) {
+            return *slot(i);
+        }
+
+        const T &operator[](size_t i) const {
+            return *slot(i);
+        }
+
+        T &at(size_t i) {
+            return const_cast<T &>(static_cast<const RingBuffer &>(*this).at(i));
+        }
+
+        const T &at(size_t i) const {
+            if (i >= m_size) {
+                throw std::out_of_range(out_of_range);
+            }
+            return *slot(i);
+        }
+
+        T &front() {
+            return at(0);
+        }
+
+        const T &front() const {
+            return at(0);
+        }
+
+        T &back() {
+            return at(m_size - 1);
+        }
+
+        const T &back() const {
+            return at(m_size - 1);
+        }
+
+        void clear() noexcept {
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                for (size_t i = 0; i < m_size; ++i) slot(i)->~T();
+            }
+            m_head = m_size = 0;
+        }
+
+        // 只对 Grow 策略有效，容量向上取整到 2 的幂
+        void reserve(size_t n) {
+            if (!bounded() && n > m_capacity) {
+                reallocate(detail::ceil_pow2(n));
+            }
+        }
+
+        void shrink_to_fit() {
+            if (bounded()) return;
+            if (m_size == 0) {
+                free();
+            } else if (detail::ceil_pow2(m_size) < m_capacity) {
+                reallocate(detail::ceil_pow2(m_size));
+            }
+        }
+
+        iterator begin() {
+            return iterator(this, 0);
+        }
+
+        iterator end() {
+            return iterator(this, m_size);
+        }
+
+        const_iterator begin() const {
+            return const_iterator(this, 0);
+        }
+
+        const_iterator end() const {
+            return const_iterator(this, m_size);
+        }
+
+        size_t size() const noexcept {
+            return m_size;
+        }
+
+        size_t capacity() const noexcept {
+            return bounded() ? m_limit : m_capacity;
+        }
+
+        bool empty() const noexcept {
+            return m_size == 0;
+        }
+
+        bool full() const noexcept {
+            return m_size == capacity();
+        }
+
+        RingPolicy policy() const noexcept {
+            return m_policy;
+        }
+
+        Alloc get_allocator() const {
+            return alloc();
+        }
+    };
+
+    template<typename T, typename Alloc>
+    bool operator==(const RingBuffer<T, Alloc> &a, const RingBuffer<T, Alloc> &b) {
+        if (a.size() != b.size()) return false;
+        for (size_t i = 0; i < a.size(); ++i) {
+            if (!(a[i] == b[i])) return false;
+        }
+        return true;
+    }
+
+    template<typename T, typename Alloc>
+    bool operator!=(const RingBuffer<T, Alloc> &a, const RingBuffer<T, Alloc> &b) {
+        return !(a == b);
+    }
+
+    template<typename T, typename Alloc>
+    struct is_trivially_relocatable<RingBuffer<T, Alloc>> : is_trivially_relocatable<Alloc> {};
+
+} // namespace stl
+
+#endif //STL_RINGBUFFER_HPP
@@ -0,0 +1,499 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#ifndef STL_ROPE_HPP
+#define STL_ROPE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+#include "Instrument.hpp"
+#include "String.h"
+#include "StringView.hpp"
+
+namespace stl {
+
+    // 由多个共享字符块拼成的字符串。内部是平衡 (AVL) 的二叉树，叶子引用某个块中的一段 [offset, offset + size)，
+    // 节点和块都带原子引用计数，拷贝 Rope 只增加根节点的计数。
+    //
+    // 拼接、insert、erase、substr 都是 O(log n)，只新建路径上的节点，不复制字符 (substr 的结果与原串共享块)。
+    // 插入或追加较短的文本时，如果目标叶子所在的块只被当前 Rope 引用，就直接写入块中而不新建节点，
+    // 逐段构建长文本的均摊代价为 O(1)。
+    // 节点与块一旦共享就不再修改，因此不同线程可以各自持有同一 Rope 的拷贝；同一个 Rope 对象不能被并发修改。
+    //
+    // chunks() 按顺序给出每一段的 StringView，可以直接填入 writev 的 iovec 数组；flatten() 拼接成一个 String
+    class Rope {
+    private:
+        struct Chunk {
+            std::atomic<size_t> m_refs;
+            String m_text;
+
+            explicit Chunk(String &&text) : m_refs(1), m_text(std::move(text)) {}
+        };
+
+        struct Node {
+            std::atomic<size_t> m_refs;
+            size_t m_size;
+            size_t m_height; // 叶子为 1
+            Node *m_left;    // 内部节点的两个子树，都不为空
+            Node *m_right;
+            Chunk *m_chunk;  // 叶子引用的块
+            size_t m_offset;
+
+            bool is_leaf() const noexcept { return m_chunk != nullptr; }
+
+            StringView view() const noexcept { return StringView(m_chunk->m_text.data() + m_offset, m_size); }
+        };
+
+        // 末尾的块最多追加到这么长，更长的文本单独成块
+        static constexpr size_t chunk_size = 4096;
+        // AVL 树的高度不超过 1.44 log2(叶子数 + 2)
+        static constexpr size_t max_height = 96;
+
+        Node *m_root;
+
+        static size_t height(const Node *node) noexcept { return node ? node->m_height : 0; }
+
+        static size_t size(const Node *node) noexcept { return node ? node->m_size : 0; }
+
+        static Node *retain(Node *node) noexcept {
+            if (node) node->m_refs.fetch_add(1, std::memory_order_relaxed);
+            return node;
+        }
+
+        static bool unique(const Node *node) noexcept {
+            return node->m_refs.load(std::memory_order_acquire) == 1;
+        }
+
+        static Node *new_node(size_t size, size_t height, Node *left, Node *right, Chunk *chunk, size_t offset) {
+            Node *node = new Node{{1}, size, height, left, right, chunk, offset};
+            instrument::allocated<Rope>(sizeof(Node));
+            return node;
+        }
+
+        static void free_node(Node *node) noexcept {
+            delete node;
+            instrument::freed<Rope>(sizeof(Node));
+        }
+
+        static void release(Chunk *chunk) noexcept {
+            if (chunk->m_refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                delete chunk;
+                instrument::freed<Rope>(sizeof(Chunk));
+            }
+        }
+
+        static void release(Node *node) noexcept {
+            if (node == nullptr || node->m_refs.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                return;
+            }
+            if (node->is_leaf()) {
+                release(node->m_chunk);
+            } else {
+                release(node->m_left);
+                release(node->m_right);
+            }
+            free_node(node);
+        }
+
+        // 以下函数接管参数中节点的引用，返回的节点由调用者持有
+
+        static Node *new_leaf(String &&text) {
+            const size_t size = text.size();
+            auto *chunk = new Chunk(std::move(text));
+            instrument::allocated<Rope>(sizeof(Chunk));
+            return new_node(size, 1, nullptr, nullptr, chunk, 0);
+        }
+
+        static Node *new_leaf(StringView text) {
+            return text.empty() ? nullptr : new_leaf(String(text));
+        }
+
+        static Node *concat_node(Node *left, Node *right) {
+            const size_t h = height(left) > height(right) ? height(left) : height(right);
+            return new_node(left->m_size + right->m_size, h + 1, left, right, nullptr, 0);
+        }
+
+        // 拆开内部节点，返回两个子树。只有自己持有 node 时直接回收它，否则给子树各加一个引用
+        static std::pair<Node *, Node *> expose(Node *node) noexcept {
+            Node *left = node->m_left, *right = node->m_right;
+            if (unique(node)) {
+                free_node(node);
+            } else {
+                retain(left);
+                retain(right);
+                release(node);
+            }
+            return {left, right};
+        }
+
+        // (a, (b, c)) -> ((a, b), c)
+        static Node *rotate_left(Node *node) {
+            auto [a, right] = expose(node);
+            auto [b, c] = expose(right);
+            return concat_node(concat_node(a, b), c);
+        }
+
+        // ((a, b), c) -> (a, (b, c))
+        static Node *rotate_right(Node *node) {
+            auto [left, c] = expose(node);
+            auto [a, b] = expose(left);
+            return concat_node(a, concat_node(b, c));
+        }
+
+        // 要求 height(left) > height(right) + 1，沿 left 的右边界向下找到高度相近的子树再合并
+        static Node *join_right(Node *left, Node *right) {
+            auto [l, c] = expose(left);
+            if (height(c) <= height(right) + 1) {
+                Node *t = concat_node(c, right);
+                if (height(t) <= height(l) + 1) return concat_node(l, t);
+                return rotate_left(concat_node(l, rotate_right(t)));
+            }
+            Node *t = join_right(c, right);
+            if (height(t) <= height(l) + 1) return concat_node(l, t);
+            return rotate_left(concat_node(l, t));
+        }
+
+        static Node *join_left(Node *left, Node *right) {
+            auto [c, r] = expose(right);
+            if (height(c) <= height(left) + 1) {
+                Node *t = concat_node(left, c);
+                if (height(t) <= height(r) + 1) return concat_node(t, r);
+                return rotate_right(concat_node(rotate_left(t), r));
+            }
+            Node *t = join_left(left, c);
+            if (height(t) <= height(r) + 1) return concat_node(t, r);
+            return rotate_right(concat_node(t, r));
+        }
+
+        // 拼接两棵平衡树，O(|height(left) - height(right)|)
+        static Node *join(Node *left, Node *right) {
+            if (left == nullptr) return right;
+            if (right == nullptr) return left;
+            if (left->m_height > right->m_height + 1) return join_right(left, right);
+            if (right->m_height > left->m_height + 1) return join_left(left, right);
+            return concat_node(left, right);
+        }
+
+        // 切分为前 k 个字符和其余部分，要求 k <= size(node)
+        static std::pair<Node *, Node *> split(Node *node, size_t k) {
+            if (k == 0) return {nullptr, node};
+            if (k == node->m_size) return {node, nullptr};
+            if (node->is_leaf()) {
+                Chunk *chunk = node->m_chunk;
+                chunk->m_refs.fetch_add(2, std::memory_order_relaxed);
+                Node *left = new_node(k, 1, nullptr, nullptr, chunk, node->m_offset);
+                Node *right = new_node(node->m_size - k, 1, nullptr, nullptr, chunk, node->m_offset + k);
+                release(node);
+                return {left, right};
+            }
+            auto [l, r] = expose(node);
+            const size_t left_size = l->m_size;
+            if (k < left_size) {
+                auto [a, b] = split(l, k);
+                return {a, join(b, r)};
+            }
+            if (k == left_size) return {l, r};
+            auto [a, b] = split(r, k - left_size);
+            return {join(l, a), b};
+        }
+
+        // index 所在的叶子引用到块的末尾，且路径上的节点和块都只被自己引用时，直接插入到块中。
+        // 块的长度不超过 chunk_size，因此代价为 O(log n + chunk_size)，不分配节点
+        bool insert_in_place(size_t index, StringView text) {
+            if (m_root == nullptr || text.size() >= chunk_size) return false;
+            Node *path[max_height];
+            size_t depth = 0;
+            Node *node = m_root;
+            while (true) {
+                if (!unique(node)) return false;
+                path[depth++] = node;
+                if (node->is_leaf()) break;
+                if (index < node->m_left->m_size) {
+                    node = node->m_left;
+                } else {
+                    index -= node->m_left->m_size;
+                    node = node->m_right;
+                }
+            }
+            String &buffer = node->m_chunk->m_text;
+            if (node->m_chunk->m_refs.load(std::memory_order_acquire) != 1 ||
+                node->m_offset + node->m_size != buffer.size() || buffer.size() + text.size() > chunk_size) {
+                return false;
+            }
+            buffer.insert(text.data(), text.size(), node->m_offset + index);
+            for (size_t i = 0; i < depth; ++i) {
+                path[i]->m_size += text.size();
+            }
+            return true;
+        }
+
+        void check_index(size_t index) const {
+            if (index > size()) {
+                throw std::out_of_range("rope index out of range");
+            }
+        }
+
+        explicit Rope(Node *root) noexcept : m_root(root) {}
+
+    public:
+        // 按顺序遍历每一段字符
+        class chunk_iterator {
+        private:
+            friend class Rope;
+
+            const Node *m_stack[max_height]; // 尚未访问的右子树
+            size_t m_depth;
+            const Node *m_leaf;
+
+            void descend(const Node *node) noexcept {
+                while (!node->is_leaf()) {
+                    m_stack[m_depth++] = node->m_right;
+                    node = node->m_left;
+                }
+                m_leaf = node;
+            }
+
+            explicit chunk_iterator(const Node *root) noexcept : m_depth(0), m_leaf(nullptr) {
+                if (root) descend(root);
+            }
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = StringView;
+            using difference_type = ptrdiff_t;
+            using pointer = const StringView *;
+            using reference = StringView;
+
+            chunk_iterator() noexcept : m_depth(0), m_leaf(nullptr) {}
+
+            StringView operator*() const noexcept { return m_leaf->view(); }
+
+            chunk_iterator &operator++() noexcept {
+                if (m_depth == 0) {
+                    m_leaf = nullptr;
+                } else {
+                    descend(m_stack[--m_depth]);
+                }
+                return *this;
+            }
+
+            chunk_iterator operator++(int) noexcept {
+                chunk_iterator old = *this;
+                ++*this;
+                return old;
+            }
+
+            bool operator==(const chunk_iterator &other) const noexcept { return m_leaf == other.m_leaf; }
+
+            bool operator!=(const chunk_iterator &other) const noexcept { return m_leaf != other.m_leaf; }
+        };
+
+        class ChunkRange {
+        private:
+            const Node *m_root;
+
+        public:
+            explicit ChunkRange(const Node *root) noexcept : m_root(root) {}
+
+            chunk_iterator begin() const noexcept { return chunk_iterator(m_root); }
+
+            chunk_iterator end() const noexcept { return chunk_iterator(); }
+        };
+
+        Rope() noexcept : m_root(nullptr) {}
+
+        Rope(const char *str) : m_root(new_leaf(StringView(str))) {}
+
+        explicit Rope(StringView str) : m_root(new_leaf(str)) {}
+
+        // 直接接管 str 的缓冲区作为一个块，不复制字符
+        explicit Rope(String &&str) : m_root(str.empty() ? nullptr : new_leaf(std::move(str))) {}
+
+        Rope(const Rope &other) noexcept : m_root(retain(other.m_root)) {}
+
+        Rope(Rope &&other) noexcept : m_root(other.m_root) {
+            other.m_root = nullptr;
+        }
+
+        Rope &operator=(const Rope &other) noexcept {
+            Node *old = m_root;
+            m_root = retain(other.m_root);
+            release(old);
+            return *this;
+        }
+
+        Rope &operator=(Rope &&other) noexcept {
+            if (this != &other) {
+                release(m_root);
+                m_root = other.m_root;
+                other.m_root = nullptr;
+            }
+            return *this;
+        }
+
+        ~Rope() {
+            release(m_root);
+        }
+
+        size_t size() const noexcept { return size(m_root); }
+
+        bool empty() const noexcept { return m_root == nullptr; }
+
+        // 树的高度，空串为 0
+        size_t height() const noexcept { return height(m_root); }
+
+        // O(log n)
+        char operator[](size_t index) const noexcept {
+            const Node *node = m_root;
+            while (!node->is_leaf()) {
+                if (index < node->m_left->m_size) {
+                    node = node->m_left;
+                } else {
+                    index -= node->m_left->m_size;
+                    node = node->m_right;
+                }
+            }
+            return node->m_chunk->m_text.data()[node->m_offset + index];
+        }
+
+        char at(size_t index) const {
+            if (index >= size()) {
+                throw std::out_of_range("rope index out of range");
+            }
+            return (*this)[index];
+        }
+
+        void clear() noexcept {
+            release(m_root);
+            m_root = nullptr;
+        }
+
+        void swap(Rope &other) noexcept {
+            std::swap(m_root, other.m_root);
+        }
+
+        void append(StringView str) {
+            if (str.empty() || insert_in_place(size(), str)) return;
+            String text;
+            if (str.size() < chunk_size / 2) {
+                text.reserve(chunk_size); // 留出空间给之后的追加
+            }
+            text.append(str.data(), str.size());
+            m_root = join(m_root, new_leaf(std::move(text)));
+        }
+
+        void append(String &&str) {
+            if (str.empty()) return;
+            if (str.size() < chunk_size / 2) {
+                append(StringView(str));
+                return;
+            }
+            m_root = join(m_root, new_leaf(std::move(str)));
+        }
+
+        // 共享 other 的节点，O(log n)
+        void append(const Rope &other) {
+            m_root = join(m_root, retain(other.m_root));
+        }
+
+        Rope &operator+=(StringView str) {
+            append(str);
+            return *this;
+        }
+
+        Rope &operator+=(const char *str) {
+            append(StringView(str));
+            return *this;
+        }
+
+        Rope &operator+=(const Rope &other) {
+            append(other);
+            return *this;
+        }
+
+        friend Rope operator+(const Rope &a, const Rope &b) {
+            return Rope(join(retain(a.m_root), retain(b.m_root)));
+        }
+
+        void insert(size_t index, const Rope &other) {
+            check_index(index);
+            auto [left, right] = split(m_root, index);
+            m_root = join(join(left, retain(other.m_root)), right);
+        }
+
+        void insert(size_t index, StringView str) {
+            check_index(index);
+            if (str.empty() || insert_in_place(index, str)) return;
+            auto [left, right] = split(m_root, index);
+            m_root = join(join(left, new_leaf(str)), right);
+        }
+
+        void insert(size_t index, const char *str) {
+            insert(index, StringView(str));
+        }
+
+        // 删除 [index, index + count)，count 超出末尾时删除到末尾
+        void erase(size_t index, size_t count = String::npos) {
+            check_index(index);
+            if (count > size() - index) count = size() - index;
+            auto [left, rest] = split(m_root, index);
+            auto [middle, right] = split(rest, count);
+            release(middle);
+            m_root = join(left, right);
+        }
+
+        // 结果与自身共享字符块，count 超出末尾时截取到末尾
+        Rope substr(size_t index, size_t count = String::npos) const {
+            check_index(index);
+            if (count > size() - index) count = size() - index;
+            auto [left, rest] = split(retain(m_root), index);
+            release(left);
+            auto [middle, right] = split(rest, count);
+            release(right);
+            return Rope(middle);
+        }
+
+        ChunkRange chunks() const noexcept {
+            return ChunkRange(m_root);
+        }
+
+        // 复制成一个连续的 String
+        String flatten(MemoryResource *resource = default_resource()) const {
+            String result(resource);
+            result.reserve(size());
+            for (const StringView chunk : chunks()) {
+                result.append(chunk);
+            }
+            return result;
+        }
+
+        friend bool operator==(const Rope &a, StringView b) {
+            if (a.size() != b.size()) return false;
+            size_t offset = 0;
+            for (const StringView chunk : a.chunks()) {
+                if (chunk != b.substr(offset, chunk.size())) return false;
+                offset += chunk.size();
+            }
+            return true;
+        }
+
+        friend bool operator!=(const Rope &a, StringView b) {
+            return !(a == b);
+        }
+
+        friend std::ostream &operator<<(std::ostream &os, const Rope &rope) {
+            for (const StringView chunk : rope.chunks()) {
+                os << chunk;
+            }
+            return os;
+        }
+    };
+
+} // namespace stl
+
+#endif //STL_ROPE_HPP
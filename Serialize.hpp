@@ -0,0 +1,420 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#ifndef STL_SERIALIZE_HPP
+#define STL_SERIALIZE_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include "Array.hpp"
+#include "List.hpp"
+#include "String.h"
+#include "Vector.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// 二进制序列化: 长度用变长整数 (LEB128) 编码，数值按本机字节序原样写出，
+// 可平凡序列化的元素组成的连续区间整体 memcpy，嵌套容器逐层递归。
+// 输出端只需提供 write(const void *, size_t)，输入端提供 read(void *, size_t) 与 remaining()
+// (剩余长度未知时返回 size_t 的最大值)，
+// 全部通过模板调用，没有虚函数。
+//
+// 自定义类型通过特化 Serializer 接入:
+//     template<> struct stl::Serializer<Point> {
+//         template<typename Writer> static void save(Writer &out, const Point &p) { serialize(out, p.x); ... }
+//         template<typename Reader> static void load(Reader &in, Point &p) { deserialize(in, p.x); ... }
+//     };
+// 只含数值成员的结构体也可以特化 is_trivially_serializable 直接按字节读写
+
+namespace stl {
+
+    template<typename T>
+    struct is_trivially_serializable : std::bool_constant<std::is_arithmetic_v<T> || std::is_enum_v<T>> {};
+
+    template<typename T, size_t N>
+    struct is_trivially_serializable<Array<T, N>> : is_trivially_serializable<T> {};
+
+    template<typename T>
+    inline constexpr bool is_trivially_serializable_v = is_trivially_serializable<T>::value;
+
+    template<typename T, typename = void>
+    struct Serializer;
+
+    template<typename Writer, typename T>
+    void serialize(Writer &out, const T &value) {
+        Serializer<T>::save(out, value);
+    }
+
+    template<typename Reader, typename T>
+    void deserialize(Reader &in, T &value) {
+        Serializer<T>::load(in, value);
+    }
+
+    template<typename T, typename Reader>
+    T deserialize(Reader &in) {
+        T value{};
+        Serializer<T>::load(in, value);
+        return value;
+    }
+
+    template<typename Writer>
+    void write_length(Writer &out, uint64_t n) {
+        unsigned char bytes[10];
+        size_t len = 0;
+        do {
+            bytes[len++] = static_cast<unsigned char>((n & 0x7F) | (n >= 0x80 ? 0x80 : 0));
+            n >>= 7;
+        } while (n);
+        out.write(bytes, len);
+    }
+
+    template<typename Reader>
+    uint64_t read_length(Reader &in) {
+        uint64_t n = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            unsigned char byte;
+            in.read(&byte, 1);
+            if (shift == 63 && (byte & 0x7E)) { // 第 10 个字节只能提供第 63 位
+                throw std::runtime_error("length prefix overflows 64 bits");
+            }
+            n |= uint64_t(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) return n;
+        }
+        throw std::runtime_error("malformed length prefix");
+    }
+
+    namespace detail {
+        // 在分配内存之前拒绝明显超出剩余输入的长度，避免损坏的数据触发巨大的分配
+        template<typename Reader>
+        size_t checked_length(Reader &in, size_t min_bytes_each) {
+            const uint64_t n = read_length(in);
+            if (min_bytes_each && n > in.remaining() / min_bytes_each) {
+                throw std::runtime_error("length prefix exceeds remaining input");
+            }
+            return static_cast<size_t>(n);
+        }
+
+        template<typename T>
+        constexpr size_t min_bytes() {
+            return is_trivially_serializable_v<T> ? sizeof(T) : 1;
+        }
+
+        inline constexpr size_t load_chunk = size_t(1) << 20;
+
+        // 已载入 done 个元素时下一批的个数。剩余长度已知时 checked_length 已经限制了 n，一次全部分配；
+        // 管道、套接字等长度未知的输入先分配约 load_chunk 字节，之后每批不超过已经读到的数量，
+        // 损坏的长度前缀最多使分配量达到实际数据的两倍左右
+        template<typename Reader>
+        size_t load_step(Reader &in, size_t done, size_t n, size_t bytes_each) {
+            if (in.remaining() != std::numeric_limits<size_t>::max()) return n - done;
+            return std::min(n - done, std::max(done, std::max<size_t>(load_chunk / bytes_each, 1)));
+        }
+
+        // 可平凡序列化的元素分批读入 v
+        template<typename Reader, typename T, typename Alloc, typename Growth>
+        void load_trivial(Reader &in, Vector<T, Alloc, Growth> &v, size_t n) {
+            size_t done = 0;
+            do {
+                const size_t step = load_step(in, done, n, sizeof(T));
+                v.resize_for_overwrite(done + step);
+                in.read(v.data() + done, step * sizeof(T));
+                done += step;
+            } while (done < n);
+        }
+    } // namespace detail
+
+    template<typename T>
+    struct Serializer<T, std::enable_if_t<is_trivially_serializable_v<T>>> {
+        template<typename Writer>
+        static void save(Writer &out, const T &value) {
+            out.write(&value, sizeof(T));
+        }
+
+        template<typename Reader>
+        static void load(Reader &in, T &value) {
+            in.read(&value, sizeof(T));
+        }
+    };
+
+    // 载入时复用已有的容量和元素 (嵌套容器中的缓冲区也会被复用)
+    template<typename T, typename Alloc, typename Growth>
+    struct Serializer<Vector<T, Alloc, Growth>> {
+        template<typename Writer>
+        static void save(Writer &out, const Vector<T, Alloc, Growth> &v) {
+            write_length(out, v.size());
+            if constexpr (is_trivially_serializable_v<T>) {
+                out.write(v.data(), v.size() * sizeof(T));
+            } else {
+                for (const T &value : v) serialize(out, value);
+            }
+        }
+
+        template<typename Reader>
+        static void load(Reader &in, Vector<T, Alloc, Growth> &v) {
+            const size_t n = detail::checked_length(in, detail::min_bytes<T>());
+            if constexpr (is_trivially_serializable_v<T>) {
+                detail::load_trivial(in, v, n);
+            } else {
+                size_t done = 0;
+                do {
+                    const size_t step = detail::load_step(in, done, n, sizeof(T));
+                    v.resize(done + step);
+                    for (; done < v.size(); ++done) deserialize(in, v[done]);
+                } while (done < n);
+            }
+        }
+    };
+
+    template<typename T, typename Alloc>
+    struct Serializer<List<T, Alloc>> {
+        template<typename Writer>
+        static void save(Writer &out, const List<T, Alloc> &list) {
+            write_length(out, list.size());
+            for (const T &value : list) serialize(out, value);
+        }
+
+        template<typename Reader>
+        static void load(Reader &in, List<T, Alloc> &list) {
+            // 已有的节点复用，其余的节点读到一个才追加一个，长度未知的输入上不会预先创建 n 个节点
+            const size_t n = detail::checked_length(in, detail::min_bytes<T>());
+            if (list.size() > n) list.resize(n);
+            for (T &value : list) deserialize(in, value);
+            for (size_t i = list.size(); i < n; ++i) {
+                list.emplace_back();
+                deserialize(in, list.back());
+            }
+        }
+    };
+
+    // 长度不是类型的一部分时才需要前缀，这里仍写出 N 以便发现不匹配的数据
+    template<typename T, size_t N>
+    struct Serializer<Array<T, N>, std::enable_if_t<!is_trivially_serializable_v<Array<T, N>>>> {
+        template<typename Writer>
+        static void save(Writer &out, const Array<T, N> &array) {
+            write_length(out, N);
+            for (const T &value : array) serialize(out, value);
+        }
+
+        template<typename Reader>
+        static void load(Reader &in, Array<T, N> &array) {
+            if (read_length(in) != N) {
+                throw std::runtime_error("array length mismatch");
+            }
+            for (T &value : array) deserialize(in, value);
+        }
+    };
+
+    template<>
+    struct Serializer<String> {
+        template<typename Writer>
+        static void save(Writer &out, const String &str) {
+            write_length(out, str.size());
+            out.write(str.data(), str.size());
+        }
+
+        template<typename Reader>
+        static void load(Reader &in, String &str) {
+            // assign 在容量足够时复用已有的缓冲区
+            const size_t n = detail::checked_length(in, 1);
+            char buffer[256];
+            if (n <= sizeof(buffer)) {
+                in.read(buffer, n);
+                str.assign(buffer, n);
+                return;
+            }
+            Vector<char> temp;
+            detail::load_trivial(in, temp, n);
+            str.assign(temp.data(), n);
+        }
+    };
+
+    // 写入自身持有的内存缓冲区
+    class MemoryWriter {
+    private:
+        Vector<unsigned char> m_buffer;
+
+    public:
+        void write(const void *data, size_t n) {
+            m_buffer.append_n(static_cast<const unsigned char *>(data), n);
+        }
+
+        const unsigned char *data() const noexcept {
+            return m_buffer.data();
+        }
+
+        size_t size() const noexcept {
+            return m_buffer.size();
+        }
+
+        Vector<unsigned char> &buffer() noexcept {
+            return m_buffer;
+        }
+
+        void clear() {
+            m_buffer.clear();
+        }
+    };
+
+    // 从一段内存中读取，不拷贝也不持有这段内存
+    class MemoryReader {
+    private:
+        const unsigned char *m_data;
+        size_t m_size;
+        size_t m_pos = 0;
+
+    public:
+        MemoryReader(const void *data, size_t size) : m_data(static_cast<const unsigned char *>(data)), m_size(size) {}
+
+        void read(void *data, size_t n) {
+            if (n > m_size - m_pos) {
+                throw std::runtime_error("unexpected end of input");
+            }
+            if (n) std::memcpy(data, m_data + m_pos, n);
+            m_pos += n;
+        }
+
+        size_t remaining() const noexcept {
+            return m_size - m_pos;
+        }
+    };
+
+#if defined(__unix__) || defined(__APPLE__)
+    // 带缓冲的文件描述符输出，不持有描述符；小块写入先进入缓冲区，大块数据绕过缓冲区直接写出
+    class FileWriter {
+    private:
+        int m_fd;
+        Vector<unsigned char> m_buffer;
+
+        void write_all(const unsigned char *data, size_t n) {
+            while (n) {
+                const ssize_t written = ::write(m_fd, data, n);
+                if (written < 0) {
+                    if (errno == EINTR) continue;
+                    throw std::runtime_error(std::string("write failed: ") + std::strerror(errno));
+                }
+                data += written;
+                n -= static_cast<size_t>(written);
+            }
+        }
+
+    public:
+        explicit FileWriter(int fd, size_t buffer_size = size_t(64) << 10) : m_fd(fd) {
+            m_buffer.reverse(buffer_size);
+        }
+
+        FileWriter(const FileWriter &) = delete;
+
+        FileWriter &operator=(const FileWriter &) = delete;
+
+        // 析构时无法报告错误，需要确认写入成功时应先调用 flush
+        ~FileWriter() {
+            try {
+                flush();
+            } catch (...) {}
+        }
+
+        void write(const void *data, size_t n) {
+            const auto *bytes = static_cast<const unsigned char *>(data);
+            if (m_buffer.size() + n > m_buffer.capacity()) {
+                flush();
+                if (n >= m_buffer.capacity()) {
+                    write_all(bytes, n);
+                    return;
+                }
+            }
+            m_buffer.append_n(bytes, n);
+        }
+
+        void flush() {
+            write_all(m_buffer.data(), m_buffer.size());
+            m_buffer.clear();
+        }
+    };
+
+    // 带缓冲的文件描述符输入，不持有描述符
+    class FileReader {
+    private:
+        int m_fd;
+        Vector<unsigned char> m_buffer;
+        size_t m_pos = 0;
+        size_t m_end = 0;
+        size_t m_unread = unknown; // 普通文件中尚未读入的字节数，管道、套接字等为 unknown
+
+        static constexpr size_t unknown = std::numeric_limits<size_t>::max();
+
+        // 读取最多 n 个字节，返回 0 表示文件结束
+        size_t read_some(unsigned char *data, size_t n) {
+            while (true) {
+                const ssize_t got = ::read(m_fd, data, n);
+                if (got >= 0) {
+                    if (m_unread != unknown) m_unread -= std::min(m_unread, static_cast<size_t>(got));
+                    return static_cast<size_t>(got);
+                }
+                if (errno != EINTR) {
+                    throw std::runtime_error(std::string("read failed: ") + std::strerror(errno));
+                }
+            }
+        }
+
+    public:
+        // 普通文件按构造时的大小和读写位置确定剩余长度，读取期间文件不应再增长
+        explicit FileReader(int fd, size_t buffer_size = size_t(64) << 10) : m_fd(fd) {
+            m_buffer.resize_for_overwrite(buffer_size);
+            struct stat st;
+            if (::fstat(fd, &st) == 0 && S_ISREG(st.st_mode)) {
+                const off_t offset = ::lseek(fd, 0, SEEK_CUR);
+                if (offset >= 0) m_unread = st.st_size > offset ? static_cast<size_t>(st.st_size - offset) : 0;
+            }
+        }
+
+        void read(void *data, size_t n) {
+            auto *out = static_cast<unsigned char *>(data);
+            const size_t buffered = std::min(n, m_end - m_pos);
+            if (buffered) std::memcpy(out, m_buffer.data() + m_pos, buffered);
+            m_pos += buffered;
+            out += buffered;
+            n -= buffered;
+            while (n) {
+                size_t got;
+                if (n >= m_buffer.size()) { // 大块数据直接读入目标
+                    got = read_some(out, n);
+                    if (got == 0) break;
+                } else {
+                    m_end = read_some(m_buffer.data(), m_buffer.size());
+                    if (m_end == 0) { // 缓冲区已空，m_pos 不能留在旧的 m_end 之后
+                        m_pos = 0;
+                        break;
+                    }
+                    got = std::min(n, m_end);
+                    std::memcpy(out, m_buffer.data(), got);
+                    m_pos = got;
+                }
+                out += got;
+                n -= got;
+            }
+            if (n) {
+                throw std::runtime_error("unexpected end of input");
+            }
+        }
+
+        // 普通文件返回文件中剩余的字节数加上缓冲区中未消费的字节数，其他描述符返回 unknown
+        size_t remaining() const noexcept {
+            return m_unread == unknown ? unknown : m_unread + (m_end - m_pos);
+        }
+    };
+#endif
+
+} // namespace stl
+
+#endif //STL_SERIALIZE_HPP
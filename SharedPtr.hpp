@@ -6,6 +6,8 @@
 #define STL_SHAREDPTR_HPP
 
 #include <atomic>
+#include "Instrument.hpp"
+#include "Uninitialized.hpp"
 
 namespace stl {
     struct RefCount {
@@ -26,8 +28,12 @@ namespace stl {
         SharedPtr(std::nullptr_t = nullptr)
             : m_ptr(nullptr), m_refcount(nullptr) {}
 
+        // 接管 ptr 时把对象和引用计数都记为一次分配
         explicit SharedPtr(T *ptr)
-            : m_ptr(ptr), m_refcount(new RefCount(1)) {}
+            : m_ptr(ptr), m_refcount(new RefCount(1)) {
+            instrument::allocated<SharedPtr>(sizeof(RefCount));
+            if (ptr) instrument::allocated<SharedPtr>(sizeof(T));
+        }
 
         SharedPtr(const SharedPtr& other)
             : m_ptr(other.m_ptr), m_refcount(other.m_refcount){
@@ -38,6 +44,8 @@ namespace stl {
             if (m_ptr && m_refcount->decref() == 0) {
                 delete m_ptr;
                 delete m_refcount;
+                instrument::freed<SharedPtr>(sizeof(T));
+                instrument::freed<SharedPtr>(sizeof(RefCount));
                 m_ptr = nullptr;
                 m_refcount = nullptr;
             }
@@ -56,5 +64,8 @@ namespace stl {
     SharedPtr<T> makeSharedPtr(Args&& ...args) {
         return SharedPtr<T>(new T(std::forward<Args>(args)...));
     }
+
+    template<typename T>
+    struct is_trivially_relocatable<SharedPtr<T>> : std::true_type {};
 } // namespace stl
 #endif //STL_SHAREDPTR_HPP
@@ -0,0 +1,842 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#ifndef STL_SIMD_HPP
+#define STL_SIMD_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+// 向量化算法: 内核用 GCC/Clang 的向量扩展编写，在带 target 属性的包装函数中展开，
+// 运行时按 CPU 支持的指令集 (SSE2/AVX2/AVX-512) 选择实现，其他平台只使用标量版本
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define STL_SIMD_X86 1
+#define STL_SIMD_TARGET(isa) __attribute__((target(isa)))
+#define STL_SIMD_AVX512 "avx512f,avx512bw,avx512dq,avx512vl"
+#else
+#define STL_SIMD_X86 0
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define STL_SIMD_INLINE inline __attribute__((always_inline))
+#else
+#define STL_SIMD_INLINE inline
+#endif
+
+namespace stl {
+
+    // 可平凡比较: 逐字节相等等价于值相等 (浮点数的 -0.0 和 NaN、带填充的结构体都不满足)
+    // 自定义类型可以特化该模板，使容器的 operator== 直接使用 memcmp
+    template<typename T>
+    struct is_trivially_comparable
+            : std::bool_constant<std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>> {};
+
+    template<typename T>
+    inline constexpr bool is_trivially_comparable_v = is_trivially_comparable<T>::value;
+
+    namespace simd {
+
+        enum class Isa : int {
+            Scalar = 0,
+            SSE2 = 1,
+            AVX2 = 2,
+            AVX512 = 3,
+        };
+
+        inline const char *isa_name(Isa isa) noexcept {
+            switch (isa) {
+                case Isa::SSE2: return "sse2";
+                case Isa::AVX2: return "avx2";
+                case Isa::AVX512: return "avx512";
+                default: return "scalar";
+            }
+        }
+
+        // CPU 支持的最高指令集
+        inline Isa detected_isa() noexcept {
+#if STL_SIMD_X86
+            static const Isa isa = [] {
+                __builtin_cpu_init();
+                if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+                    __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512vl")) {
+                    return Isa::AVX512;
+                }
+                if (__builtin_cpu_supports("avx2")) return Isa::AVX2;
+                return Isa::SSE2;
+            }();
+            return isa;
+#else
+            return Isa::Scalar;
+#endif
+        }
+
+        namespace detail {
+            inline std::atomic<int> &isa_slot() noexcept {
+                static std::atomic<int> slot{static_cast<int>(detected_isa())};
+                return slot;
+            }
+        } // namespace detail
+
+        // 当前使用的指令集
+        inline Isa active_isa() noexcept {
+            return static_cast<Isa>(detail::isa_slot().load(std::memory_order_relaxed));
+        }
+
+        // 限制使用的指令集 (不会超过 CPU 支持的范围)，主要用于测试和基准对比
+        inline void set_isa(Isa isa) noexcept {
+            if (static_cast<int>(isa) > static_cast<int>(detected_isa())) isa = detected_isa();
+            detail::isa_slot().store(static_cast<int>(isa), std::memory_order_relaxed);
+        }
+
+        // 有向量内核的元素类型
+        template<typename T>
+        inline constexpr bool is_simd_type_v = std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t> ||
+                                               std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi" // 内核都是强制内联的，不存在跨函数传递向量的 ABI 问题
+#endif
+
+        namespace detail {
+
+            // 宽度为 W 字节的向量
+            template<typename T, size_t W>
+            struct Vec {
+                typedef T type __attribute__((vector_size(W)));
+                static constexpr size_t lanes = W / sizeof(T);
+            };
+
+            template<typename V, typename T>
+            STL_SIMD_INLINE V load(const T *p) noexcept {
+                V v;
+                std::memcpy(&v, p, sizeof(V));
+                return v;
+            }
+
+            template<typename V, typename T>
+            STL_SIMD_INLINE void store(T *p, const V &v) noexcept {
+                std::memcpy(p, &v, sizeof(V));
+            }
+
+            // 在寄存器中按 64 位取出各部分，经由内存取出会在宽向量上触发存储转发停顿；
+            // 两个比较结果应分别 any 后再合并，GCC 会把 512 位掩码的按位或拆成标量比较
+            template<typename M>
+            STL_SIMD_INLINE bool any(const M &m) noexcept {
+                const auto u = reinterpret_cast<typename Vec<uint64_t, sizeof(M)>::type>(m);
+                uint64_t r = 0;
+                for (size_t i = 0; i < sizeof(M) / 8; ++i) r |= u[i];
+                return r != 0;
+            }
+
+            // 以下内核在调用者的 target 属性下展开，W 为向量字节数
+
+            template<typename T, size_t W>
+            STL_SIMD_INLINE bool equal(const T *a, const T *b, size_t n) noexcept {
+                using V = typename Vec<T, W>::type;
+                constexpr size_t L = Vec<T, W>::lanes;
+                size_t i = 0;
+                for (; i + 2 * L <= n; i += 2 * L) {
+                    if (any(load<V>(a + i) != load<V>(b + i)) | any(load<V>(a + i + L) != load<V>(b + i + L))) {
+                        return false;
+                    }
+                }
+                for (; i < n; ++i) {
+                    if (a[i] != b[i]) return false;
+                }
+                return true;
+            }
+
+            template<typename T, size_t W>
+            STL_SIMD_INLINE void fill(T *p, size_t n, T value) noexcept {
+                using V = typename Vec<T, W>::type;
+                constexpr size_t L = Vec<T, W>::lanes;
+                const V v = V{} + value;
+                size_t i = 0;
+                for (; i + 4 * L <= n; i += 4 * L) {
+                    store(p + i, v);
+                    store(p + i + L, v);
+                    store(p + i + 2 * L, v);
+                    store(p + i + 3 * L, v);
+                }
+                for (; i + L <= n; i += L) {
+                    store(p + i, v);
+                }
+                for (; i < n; ++i) {
+                    p[i] = value;
+                }
+            }
+
+            template<typename T, size_t W>
+            STL_SIMD_INLINE size_t find(const T *p, size_t n, T value) noexcept {
+                using V = typename Vec<T, W>::type;
+                constexpr size_t L = Vec<T, W>::lanes;
+                size_t i = 0;
+                for (; i + 2 * L <= n; i += 2 * L) {
+                    if (any(load<V>(p + i) == value) | any(load<V>(p + i + L) == value)) {
+                        break;
+                    }
+                }
+                for (; i < n; ++i) {
+                    if (p[i] == value) return i;
+                }
+                return n;
+            }
+
+            template<typename T, size_t W>
+            STL_SIMD_INLINE size_t count(const T *p, size_t n, T value) noexcept {
+                using V = typename Vec<T, W>::type;
+                using M = decltype(V{} == V{});
+                constexpr size_t L = Vec<T, W>::lanes;
+                constexpr size_t flush = size_t(1) << 24; // 每条通道的计数在溢出之前归并
+                size_t total = 0, i = 0;
+                while (i + L <= n) {
+                    M acc{};
+                    const size_t stop = (n - i) / L > flush ? i + flush * L : n - (n - i) % L;
+                    for (; i < stop; i += L) {
+                        acc -= (load<V>(p + i) == value);
+                    }
+                    for (size_t k = 0; k < L; ++k) total += static_cast<size_t>(acc[k]);
+                }
+                for (; i < n; ++i) {
+                    total += p[i] == value;
+                }
+                return total;
+            }
+
+            template<typename T, size_t W, bool Max>
+            STL_SIMD_INLINE T extreme(const T *p, size_t n) noexcept {
+                using V = typename Vec<T, W>::type;
+                constexpr size_t L = Vec<T, W>::lanes;
+                T best = p[0];
+                size_t i = 0;
+                if (n >= L) {
+                    V m = load<V>(p);
+                    for (i = L; i + L <= n; i += L) {
+                        const V v = load<V>(p + i);
+                        m = Max ? (v > m ? v : m) : (v < m ? v : m);
+                    }
+                    best = m[0];
+                    for (size_t k = 1; k < L; ++k) {
+                        best = Max ? (m[k] > best ? m[k] : best) : (m[k] < best ? m[k] : best);
+                    }
+                }
+                for (; i < n; ++i) {
+                    best = Max ? (p[i] > best ? p[i] : best) : (p[i] < best ? p[i] : best);
+                }
+                return best;
+            }
+
+            template<typename T, size_t W>
+            STL_SIMD_INLINE T sum(const T *p, size_t n) noexcept {
+                using V = typename Vec<T, W>::type;
+                constexpr size_t L = Vec<T, W>::lanes;
+                V s0{}, s1{}, s2{}, s3{}; // 多个累加器隐藏加法延迟
+                size_t i = 0;
+                for (; i + 4 * L <= n; i += 4 * L) {
+                    s0 += load<V>(p + i);
+                    s1 += load<V>(p + i + L);
+                    s2 += load<V>(p + i + 2 * L);
+                    s3 += load<V>(p + i + 3 * L);
+                }
+                const V s = (s0 + s1) + (s2 + s3);
+                T total = T();
+                for (size_t k = 0; k < L; ++k) total += s[k];
+                for (; i < n; ++i) {
+                    total += p[i];
+                }
+                return total;
+            }
+
+            template<typename T, size_t W>
+            STL_SIMD_INLINE T dot(const T *a, const T *b, size_t n) noexcept {
+                using V = typename Vec<T, W>::type;
+                constexpr size_t L = Vec<T, W>::lanes;
+                V s0{}, s1{}, s2{}, s3{};
+                size_t i = 0;
+                for (; i + 4 * L <= n; i += 4 * L) {
+                    s0 += load<V>(a + i) * load<V>(b + i);
+                    s1 += load<V>(a + i + L) * load<V>(b + i + L);
+                    s2 += load<V>(a + i + 2 * L) * load<V>(b + i + 2 * L);
+                    s3 += load<V>(a + i + 3 * L) * load<V>(b + i + 3 * L);
+                }
+                const V s = (s0 + s1) + (s2 + s3);
+                T total = T();
+                for (size_t k = 0; k < L; ++k) total += s[k];
+                for (; i < n; ++i) {
+                    total += a[i] * b[i];
+                }
+                return total;
+            }
+
+            enum class Op { Add, Sub, Mul, And, Or, Xor, AndNot };
+
+            // 对向量和标量都适用，位运算只用于整数
+            // 按引用传递，避免宽向量按值传参带来的 ABI 警告
+            template<Op op, typename V>
+            STL_SIMD_INLINE void apply(V &r, const V &x, const V &y) noexcept {
+                if constexpr (op == Op::Add) r = x + y;
+                else if constexpr (op == Op::Sub) r = x - y;
+                else if constexpr (op == Op::Mul) r = x * y;
+                else if constexpr (op == Op::And) r = x & y;
+                else if constexpr (op == Op::Or) r = x | y;
+                else if constexpr (op == Op::Xor) r = x ^ y;
+                else r = x & ~y;
+            }
+
+            template<typename T, size_t W, Op op>
+            STL_SIMD_INLINE void arith(const T *a, const T *b, T *out, size_t n) noexcept {
+                using V = typename Vec<T, W>::type;
+                constexpr size_t L = Vec<T, W>::lanes;
+                size_t i = 0;
+                for (; i + L <= n; i += L) {
+                    const V x = load<V>(a + i), y = load<V>(b + i);
+                    V r;
+                    apply<op>(r, x, y);
+                    store(out + i, r);
+                }
+                for (; i < n; ++i) {
+                    apply<op>(out[i], a[i], b[i]);
+                }
+            }
+
+            // 多个累加器隐藏 popcnt 的延迟
+            STL_SIMD_INLINE size_t popcount(const uint64_t *p, size_t n) noexcept {
+                size_t c0 = 0, c1 = 0, c2 = 0, c3 = 0, i = 0;
+                for (; i + 4 <= n; i += 4) {
+                    c0 += __builtin_popcountll(p[i]);
+                    c1 += __builtin_popcountll(p[i + 1]);
+                    c2 += __builtin_popcountll(p[i + 2]);
+                    c3 += __builtin_popcountll(p[i + 3]);
+                }
+                for (; i < n; ++i) {
+                    c0 += __builtin_popcountll(p[i]);
+                }
+                return (c0 + c1) + (c2 + c3);
+            }
+
+#if STL_SIMD_X86
+            // 基线 x86-64 没有 popcnt 指令，__builtin_popcountll 会调用查表实现
+            STL_SIMD_TARGET("popcnt") inline size_t popcount_native(const uint64_t *p, size_t n) noexcept {
+                return popcount(p, n);
+            }
+#endif
+
+            // 以下为字节串内核，只在 x86 (小端) 上展开。比较结果按 64 位分段取出，
+            // 每个字节的最高位对应一个位置
+
+            // 第一个为真的字节下标，要求 any(m)
+            template<typename M>
+            STL_SIMD_INLINE size_t first_true(const M &m) noexcept {
+                const auto u = reinterpret_cast<typename Vec<uint64_t, sizeof(M)>::type>(m);
+                size_t i = 0;
+                while (!u[i]) ++i;
+                return i * 8 + (__builtin_ctzll(u[i]) >> 3);
+            }
+
+            inline constexpr uint64_t byte_high_bits = 0x8080808080808080ULL;
+
+            // 模式串除首尾以外的部分是否相同，首尾已经由过滤比较过
+            STL_SIMD_INLINE bool middle_equal(const char *text, const char *pattern, size_t m) noexcept {
+                return m < 3 || std::memcmp(text + 1, pattern + 1, m - 2) == 0;
+            }
+
+            template<size_t W>
+            STL_SIMD_INLINE size_t find_char(const char *p, size_t n, char c) noexcept {
+                using V = typename Vec<char, W>::type;
+                size_t i = 0;
+                for (; i + 2 * W <= n; i += 2 * W) {
+                    const auto a = load<V>(p + i) == c, b = load<V>(p + i + W) == c;
+                    if (any(a) | any(b)) {
+                        return any(a) ? i + first_true(a) : i + W + first_true(b);
+                    }
+                }
+                if (n >= W) {
+                    // 剩余部分用最后一个 (可能与前面重叠的) 整块检查
+                    for (; i + W <= n; i += W) {
+                        const auto a = load<V>(p + i) == c;
+                        if (any(a)) return i + first_true(a);
+                    }
+                    if (i < n) {
+                        const auto a = load<V>(p + n - W) == c;
+                        return any(a) ? n - W + first_true(a) : n;
+                    }
+                    return n;
+                }
+                for (; i < n; ++i) {
+                    if (p[i] == c) return i;
+                }
+                return n;
+            }
+
+            template<size_t W>
+            STL_SIMD_INLINE size_t count_char(const char *p, size_t n, char c) noexcept {
+                using V = typename Vec<char, W>::type;
+                using U = typename Vec<unsigned char, W>::type;
+                constexpr size_t flush = 255; // 每条通道是一个字节，溢出之前归并
+                size_t total = 0, i = 0;
+                while (i + W <= n) {
+                    U acc{};
+                    const size_t stop = (n - i) / W > flush ? i + flush * W : n - (n - i) % W;
+                    for (; i < stop; i += W) {
+                        acc -= reinterpret_cast<U>(load<V>(p + i) == c);
+                    }
+                    for (size_t k = 0; k < W; ++k) total += acc[k];
+                }
+                for (; i < n; ++i) {
+                    total += p[i] == c;
+                }
+                return total;
+            }
+
+            // set 中最多 16 个字符，每块与各个字符分别比较
+            template<size_t W>
+            STL_SIMD_INLINE size_t find_first_of(const char *p, size_t n, const char *set, size_t m) noexcept {
+                using V = typename Vec<char, W>::type;
+                size_t i = 0;
+                for (; i + W <= n; i += W) {
+                    const V v = load<V>(p + i);
+                    auto hit = v == set[0];
+                    for (size_t k = 1; k < m; ++k) hit |= v == set[k];
+                    if (any(hit)) return i + first_true(hit);
+                }
+                for (; i < n; ++i) {
+                    if (std::memchr(set, p[i], m)) return i;
+                }
+                return n;
+            }
+
+            // 首尾字节过滤: 同时比较候选位置的首字节和尾字节，只有两者都相同时才比较中间部分。要求 m >= 1。
+            // 先异或再比较一次，两个比较结果按位与在 512 位上同样会被拆成标量操作
+            template<size_t W>
+            STL_SIMD_INLINE size_t search(const char *text, size_t n, const char *pattern, size_t m) noexcept {
+                using V = typename Vec<char, W>::type;
+                const V first = V{} + pattern[0], last = V{} + pattern[m - 1];
+                size_t i = 0;
+                for (; i + m - 1 + W <= n; i += W) {
+                    const auto hit = ((load<V>(text + i) ^ first) | (load<V>(text + i + m - 1) ^ last)) == 0;
+                    if (!any(hit)) continue;
+                    const auto u = reinterpret_cast<typename Vec<uint64_t, W>::type>(hit);
+                    for (size_t j = 0; j < W / 8; ++j) {
+                        for (uint64_t bits = u[j] & byte_high_bits; bits; bits &= bits - 1) {
+                            const size_t k = i + j * 8 + (__builtin_ctzll(bits) >> 3);
+                            if (middle_equal(text + k, pattern, m)) return k;
+                        }
+                    }
+                }
+                for (; i + m <= n; ++i) {
+                    if (text[i] == pattern[0] && text[i + m - 1] == pattern[m - 1] && middle_equal(text + i, pattern, m)) {
+                        return i;
+                    }
+                }
+                return n;
+            }
+
+            // 从后向前的首尾字节过滤，返回最后一次出现的位置。要求 1 <= m <= n
+            template<size_t W>
+            STL_SIMD_INLINE size_t search_last(const char *text, size_t n, const char *pattern, size_t m) noexcept {
+                using V = typename Vec<char, W>::type;
+                const V first = V{} + pattern[0], last = V{} + pattern[m - 1];
+                size_t i = n - m + 1; // 尚未检查的候选起点为 [0, i)
+                for (; i >= W; i -= W) {
+                    const size_t base = i - W;
+                    const auto hit = ((load<V>(text + base) ^ first) | (load<V>(text + base + m - 1) ^ last)) == 0;
+                    if (!any(hit)) continue;
+                    const auto u = reinterpret_cast<typename Vec<uint64_t, W>::type>(hit);
+                    for (size_t j = W / 8; j-- > 0;) {
+                        for (uint64_t bits = u[j] & byte_high_bits; bits; bits &= ~(uint64_t(1) << (63 - __builtin_clzll(bits)))) {
+                            const size_t k = base + j * 8 + ((63 - __builtin_clzll(bits)) >> 3);
+                            if (middle_equal(text + k, pattern, m)) return k;
+                        }
+                    }
+                }
+                while (i-- > 0) {
+                    if (text[i] == pattern[0] && text[i + m - 1] == pattern[m - 1] && middle_equal(text + i, pattern, m)) {
+                        return i;
+                    }
+                }
+                return n;
+            }
+
+            // 标量实现，也是不支持向量扩展时的后备
+            template<typename T>
+            struct Scalar {
+                static bool equal(const T *a, const T *b, size_t n) noexcept {
+                    for (size_t i = 0; i < n; ++i) {
+                        if (a[i] != b[i]) return false;
+                    }
+                    return true;
+                }
+
+                static void fill(T *p, size_t n, T value) noexcept {
+                    for (size_t i = 0; i < n; ++i) p[i] = value;
+                }
+
+                static size_t find(const T *p, size_t n, T value) noexcept {
+                    for (size_t i = 0; i < n; ++i) {
+                        if (p[i] == value) return i;
+                    }
+                    return n;
+                }
+
+                static size_t count(const T *p, size_t n, T value) noexcept {
+                    size_t total = 0;
+                    for (size_t i = 0; i < n; ++i) total += p[i] == value;
+                    return total;
+                }
+
+                static T min(const T *p, size_t n) noexcept {
+                    T best = p[0];
+                    for (size_t i = 1; i < n; ++i) best = p[i] < best ? p[i] : best;
+                    return best;
+                }
+
+                static T max(const T *p, size_t n) noexcept {
+                    T best = p[0];
+                    for (size_t i = 1; i < n; ++i) best = p[i] > best ? p[i] : best;
+                    return best;
+                }
+
+                static T sum(const T *p, size_t n) noexcept {
+                    T total = T();
+                    for (size_t i = 0; i < n; ++i) total += p[i];
+                    return total;
+                }
+
+                static T dot(const T *a, const T *b, size_t n) noexcept {
+                    T total = T();
+                    for (size_t i = 0; i < n; ++i) total += a[i] * b[i];
+                    return total;
+                }
+
+                template<Op op>
+                static void arith(const T *a, const T *b, T *out, size_t n) noexcept {
+                    for (size_t i = 0; i < n; ++i) {
+                        apply<op>(out[i], a[i], b[i]);
+                    }
+                }
+
+                static size_t find_char(const char *p, size_t n, char c) noexcept {
+                    const void *r = std::memchr(p, c, n);
+                    return r ? static_cast<const char *>(r) - p : n;
+                }
+
+                static size_t count_char(const char *p, size_t n, char c) noexcept {
+                    size_t total = 0;
+                    for (size_t i = 0; i < n; ++i) total += p[i] == c;
+                    return total;
+                }
+
+                static size_t find_first_of(const char *p, size_t n, const char *set, size_t m) noexcept {
+                    for (size_t i = 0; i < n; ++i) {
+                        if (std::memchr(set, p[i], m)) return i;
+                    }
+                    return n;
+                }
+
+                static size_t search(const char *text, size_t n, const char *pattern, size_t m) noexcept {
+                    for (size_t i = 0; i + m <= n; ++i) {
+                        if (text[i] == pattern[0] && std::memcmp(text + i + 1, pattern + 1, m - 1) == 0) return i;
+                    }
+                    return n;
+                }
+
+                static size_t search_last(const char *text, size_t n, const char *pattern, size_t m) noexcept {
+                    for (size_t i = n - m + 1; i-- > 0;) {
+                        if (text[i] == pattern[0] && std::memcmp(text + i + 1, pattern + 1, m - 1) == 0) return i;
+                    }
+                    return n;
+                }
+            };
+
+// 为一个指令集生成一组包装函数
+#define STL_SIMD_KERNELS(Name, W, BW, ...)                                                                      \
+            template<typename T>                                                                              \
+            struct Name {                                                                                     \
+                __VA_ARGS__ static bool equal(const T *a, const T *b, size_t n) noexcept {                    \
+                    return detail::equal<T, W>(a, b, n);                                                      \
+                }                                                                                             \
+                __VA_ARGS__ static void fill(T *p, size_t n, T value) noexcept {                              \
+                    detail::fill<T, W>(p, n, value);                                                          \
+                }                                                                                             \
+                __VA_ARGS__ static size_t find(const T *p, size_t n, T value) noexcept {                      \
+                    return detail::find<T, W>(p, n, value);                                                   \
+                }                                                                                             \
+                __VA_ARGS__ static size_t count(const T *p, size_t n, T value) noexcept {                     \
+                    return detail::count<T, W>(p, n, value);                                                  \
+                }                                                                                             \
+                __VA_ARGS__ static T min(const T *p, size_t n) noexcept {                                     \
+                    return detail::extreme<T, W, false>(p, n);                                                \
+                }                                                                                             \
+                __VA_ARGS__ static T max(const T *p, size_t n) noexcept {                                     \
+                    return detail::extreme<T, W, true>(p, n);                                                 \
+                }                                                                                             \
+                __VA_ARGS__ static T sum(const T *p, size_t n) noexcept {                                     \
+                    return detail::sum<T, W>(p, n);                                                           \
+                }                                                                                             \
+                __VA_ARGS__ static T dot(const T *a, const T *b, size_t n) noexcept {                         \
+                    return detail::dot<T, W>(a, b, n);                                                        \
+                }                                                                                             \
+                template<Op op>                                                                               \
+                __VA_ARGS__ static void arith(const T *a, const T *b, T *out, size_t n) noexcept {            \
+                    detail::arith<T, W, op>(a, b, out, n);                                                    \
+                }                                                                                             \
+                __VA_ARGS__ static size_t find_char(const char *p, size_t n, char c) noexcept {               \
+                    return detail::find_char<BW>(p, n, c);                                                     \
+                }                                                                                             \
+                __VA_ARGS__ static size_t count_char(const char *p, size_t n, char c) noexcept {              \
+                    return detail::count_char<BW>(p, n, c);                                                    \
+                }                                                                                             \
+                __VA_ARGS__ static size_t find_first_of(const char *p, size_t n, const char *set,              \
+                                                        size_t m) noexcept {                                  \
+                    return detail::find_first_of<BW>(p, n, set, m);                                            \
+                }                                                                                             \
+                __VA_ARGS__ static size_t search(const char *text, size_t n, const char *pattern,              \
+                                                 size_t m) noexcept {                                         \
+                    return detail::search<BW>(text, n, pattern, m);                                            \
+                }                                                                                             \
+                __VA_ARGS__ static size_t search_last(const char *text, size_t n, const char *pattern,         \
+                                                      size_t m) noexcept {                                    \
+                    return detail::search_last<BW>(text, n, pattern, m);                                       \
+                }                                                                                             \
+            };
+
+#if STL_SIMD_X86
+            // BW 是字节扫描的宽度。AVX-512 的掩码转回向量代价较高，匹配位置通常很近时 32 字节更快
+            STL_SIMD_KERNELS(SSE2, 16, 16)
+            STL_SIMD_KERNELS(AVX2, 32, 32, STL_SIMD_TARGET("avx2"))
+            STL_SIMD_KERNELS(AVX512, 64, 32, STL_SIMD_TARGET(STL_SIMD_AVX512))
+#endif
+
+#undef STL_SIMD_KERNELS
+
+// 按当前指令集分派到对应的实现
+#if STL_SIMD_X86
+#define STL_SIMD_DISPATCH(call)                                                                               \
+            switch (active_isa()) {                                                                           \
+                case Isa::AVX512: return detail::AVX512<T>::call;                                             \
+                case Isa::AVX2: return detail::AVX2<T>::call;                                                 \
+                case Isa::SSE2: return detail::SSE2<T>::call;                                                 \
+                default: return detail::Scalar<T>::call;                                                      \
+            }
+#else
+#define STL_SIMD_DISPATCH(call) return detail::Scalar<T>::call;
+#endif
+
+        } // namespace detail
+
+        // 以下函数要求 T 满足 is_simd_type_v<T>
+
+        template<typename T>
+        bool equal(const T *a, const T *b, size_t n) noexcept {
+            STL_SIMD_DISPATCH(equal(a, b, n))
+        }
+
+        template<typename T>
+        void fill(T *p, size_t n, T value) noexcept {
+            STL_SIMD_DISPATCH(fill(p, n, value))
+        }
+
+        // 返回第一个等于 value 的下标，不存在时返回 n
+        template<typename T>
+        size_t find(const T *p, size_t n, T value) noexcept {
+            STL_SIMD_DISPATCH(find(p, n, value))
+        }
+
+        template<typename T>
+        size_t count(const T *p, size_t n, T value) noexcept {
+            STL_SIMD_DISPATCH(count(p, n, value))
+        }
+
+        // 要求 n > 0，存在 NaN 时结果不确定
+        template<typename T>
+        T min(const T *p, size_t n) noexcept {
+            STL_SIMD_DISPATCH(min(p, n))
+        }
+
+        template<typename T>
+        T max(const T *p, size_t n) noexcept {
+            STL_SIMD_DISPATCH(max(p, n))
+        }
+
+        // 浮点数的累加顺序与逐个相加不同，结果可能有舍入误差
+        template<typename T>
+        T sum(const T *p, size_t n) noexcept {
+            STL_SIMD_DISPATCH(sum(p, n))
+        }
+
+        template<typename T>
+        T dot(const T *a, const T *b, size_t n) noexcept {
+            STL_SIMD_DISPATCH(dot(a, b, n))
+        }
+
+        // out[i] = a[i] op b[i]，out 可以与 a 或 b 相同
+        template<typename T>
+        void add(const T *a, const T *b, T *out, size_t n) noexcept {
+            STL_SIMD_DISPATCH(template arith<detail::Op::Add>(a, b, out, n))
+        }
+
+        template<typename T>
+        void sub(const T *a, const T *b, T *out, size_t n) noexcept {
+            STL_SIMD_DISPATCH(template arith<detail::Op::Sub>(a, b, out, n))
+        }
+
+        template<typename T>
+        void mul(const T *a, const T *b, T *out, size_t n) noexcept {
+            STL_SIMD_DISPATCH(template arith<detail::Op::Mul>(a, b, out, n))
+        }
+
+        // 以下位运算要求 T 为整数 (int32_t 或 int64_t，无符号数可以按位重新解释)
+
+        template<typename T>
+        void bit_and(const T *a, const T *b, T *out, size_t n) noexcept {
+            static_assert(std::is_integral_v<T>, "bitwise operations require integers");
+            STL_SIMD_DISPATCH(template arith<detail::Op::And>(a, b, out, n))
+        }
+
+        template<typename T>
+        void bit_or(const T *a, const T *b, T *out, size_t n) noexcept {
+            static_assert(std::is_integral_v<T>, "bitwise operations require integers");
+            STL_SIMD_DISPATCH(template arith<detail::Op::Or>(a, b, out, n))
+        }
+
+        template<typename T>
+        void bit_xor(const T *a, const T *b, T *out, size_t n) noexcept {
+            static_assert(std::is_integral_v<T>, "bitwise operations require integers");
+            STL_SIMD_DISPATCH(template arith<detail::Op::Xor>(a, b, out, n))
+        }
+
+        // out[i] = a[i] & ~b[i]
+        template<typename T>
+        void bit_andnot(const T *a, const T *b, T *out, size_t n) noexcept {
+            static_assert(std::is_integral_v<T>, "bitwise operations require integers");
+            STL_SIMD_DISPATCH(template arith<detail::Op::AndNot>(a, b, out, n))
+        }
+
+        // 以下为字节串函数，找不到时返回 n
+
+        inline size_t find_char(const char *p, size_t n, char c) noexcept {
+            using T = char;
+            STL_SIMD_DISPATCH(find_char(p, n, c))
+        }
+
+        inline size_t count_char(const char *p, size_t n, char c) noexcept {
+            using T = char;
+            STL_SIMD_DISPATCH(count_char(p, n, c))
+        }
+
+        // 第一个属于 [set, set + m) 的字符。字符较多时改用 256 位的表
+        inline size_t find_first_of(const char *p, size_t n, const char *set, size_t m) noexcept {
+            using T = char;
+            if (m == 0) return n;
+            if (m == 1) return find_char(p, n, set[0]);
+            if (m > 16) {
+                uint64_t table[4] = {};
+                for (size_t k = 0; k < m; ++k) {
+                    const unsigned char c = static_cast<unsigned char>(set[k]);
+                    table[c >> 6] |= uint64_t(1) << (c & 63);
+                }
+                for (size_t i = 0; i < n; ++i) {
+                    const unsigned char c = static_cast<unsigned char>(p[i]);
+                    if (table[c >> 6] >> (c & 63) & 1) return i;
+                }
+                return n;
+            }
+            STL_SIMD_DISPATCH(find_first_of(p, n, set, m))
+        }
+
+        // 子串第一次出现的位置，m 为 0 时返回 0。最坏情况为 O(n * m)，长模式串应使用 Two-Way 等线性算法
+        inline size_t search(const char *text, size_t n, const char *pattern, size_t m) noexcept {
+            using T = char;
+            if (m == 0) return 0;
+            if (m > n) return n;
+            if (m == 1) return find_char(text, n, pattern[0]);
+            STL_SIMD_DISPATCH(search(text, n, pattern, m))
+        }
+
+        // 子串最后一次出现的位置，m 为 0 时返回 n
+        inline size_t search_last(const char *text, size_t n, const char *pattern, size_t m) noexcept {
+            using T = char;
+            if (m == 0 || m > n) return n;
+            STL_SIMD_DISPATCH(search_last(text, n, pattern, m))
+        }
+
+#undef STL_SIMD_DISPATCH
+
+        // [p, p + n) 中置位的总数。支持 AVX2 的处理器都有 popcnt 指令
+        inline size_t popcount(const uint64_t *p, size_t n) noexcept {
+#if STL_SIMD_X86
+            if (active_isa() >= Isa::AVX2) return detail::popcount_native(p, n);
+#endif
+            return detail::popcount(p, n);
+        }
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+        // 容器版本: 接受任何提供 data() 与 size() 的连续容器 (Vector、Array 等)
+
+        template<typename C>
+        size_t find(const C &c, const typename C::value_type &value) noexcept {
+            return find(c.data(), c.size(), value);
+        }
+
+        template<typename C>
+        size_t count(const C &c, const typename C::value_type &value) noexcept {
+            return count(c.data(), c.size(), value);
+        }
+
+        template<typename C>
+        typename C::value_type min(const C &c) {
+            if (c.size() == 0) throw std::out_of_range("min of empty range");
+            return min(c.data(), c.size());
+        }
+
+        template<typename C>
+        typename C::value_type max(const C &c) {
+            if (c.size() == 0) throw std::out_of_range("max of empty range");
+            return max(c.data(), c.size());
+        }
+
+        template<typename C>
+        typename C::value_type sum(const C &c) noexcept {
+            return sum(c.data(), c.size());
+        }
+
+        template<typename C>
+        typename C::value_type dot(const C &a, const C &b) {
+            if (a.size() != b.size()) throw std::invalid_argument("dot of ranges with different sizes");
+            return dot(a.data(), b.data(), a.size());
+        }
+
+        // out 的大小需与 a、b 相同
+        template<typename C>
+        void add(const C &a, const C &b, C &out) {
+            if (a.size() != b.size() || a.size() != out.size()) throw std::invalid_argument("size mismatch");
+            add(a.data(), b.data(), out.data(), a.size());
+        }
+
+        template<typename C>
+        void sub(const C &a, const C &b, C &out) {
+            if (a.size() != b.size() || a.size() != out.size()) throw std::invalid_argument("size mismatch");
+            sub(a.data(), b.data(), out.data(), a.size());
+        }
+
+        template<typename C>
+        void mul(const C &a, const C &b, C &out) {
+            if (a.size() != b.size() || a.size() != out.size()) throw std::invalid_argument("size mismatch");
+            mul(a.data(), b.data(), out.data(), a.size());
+        }
+
+    } // namespace simd
+
+} // namespace stl
+
+#endif //STL_SIMD_HPP
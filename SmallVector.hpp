@@ -0,0 +1,226 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#ifndef STL_SMALLVECTOR_HPP
+#define STL_SMALLVECTOR_HPP
+
+#include "Vector.hpp"
+
+namespace stl {
+
+    namespace detail {
+        // SmallVector 的分配器: 记录内联缓冲区的地址，释放内联缓冲区时什么也不做，
+        // 其余请求交给上游分配器，因此 Vector 的扩容、插入、删除逻辑可以原样复用
+        template<typename T, typename Alloc>
+        class SmallAllocator : public Alloc {
+        private:
+            using upstream_traits = std::allocator_traits<Alloc>;
+
+            T *m_inline;
+
+        public:
+            using value_type = T;
+            using propagate_on_container_copy_assignment = std::false_type;
+            using propagate_on_container_move_assignment = std::false_type;
+            using propagate_on_container_swap = std::false_type;
+            using is_always_equal = std::false_type;
+
+            template<typename U>
+            struct rebind {
+                using other = typename upstream_traits::template rebind_alloc<U>;
+            };
+
+            SmallAllocator(T *buffer, const Alloc &upstream) : Alloc(upstream), m_inline(buffer) {}
+
+            T *allocate(size_t n) {
+                return upstream_traits::allocate(upstream(), n);
+            }
+
+            void deallocate(T *p, size_t n) {
+                if (p != m_inline) {
+                    upstream_traits::deallocate(upstream(), p, n);
+                }
+            }
+
+            // 内联缓冲区不能交给上游原地扩容
+            template<typename A = Alloc, std::enable_if_t<has_expand_v<A>, int> = 0>
+            bool expand(T *p, size_t old_n, size_t new_n) {
+                return p != m_inline && upstream().expand(p, old_n, new_n);
+            }
+
+            template<typename A = Alloc, std::enable_if_t<has_reallocate_v<A>, int> = 0>
+            T *reallocate(T *p, size_t old_n, size_t new_n) {
+                return p == m_inline ? nullptr : upstream().reallocate(p, old_n, new_n);
+            }
+
+            template<typename A = Alloc, std::enable_if_t<has_shrink_v<A>, int> = 0>
+            bool shrink(T *p, size_t old_n, size_t new_n) {
+                return p != m_inline && upstream().shrink(p, old_n, new_n);
+            }
+
+            bool is_inline(const T *p) const noexcept {
+                return p == m_inline;
+            }
+
+            Alloc &upstream() noexcept { return *this; }
+
+            const Alloc &upstream() const noexcept { return *this; }
+
+            bool operator==(const SmallAllocator &other) const noexcept {
+                return m_inline == other.m_inline;
+            }
+
+            bool operator!=(const SmallAllocator &other) const noexcept {
+                return m_inline != other.m_inline;
+            }
+        };
+    } // namespace detail
+
+    // 前 N 个元素存放在对象内部，超出之后才转移到堆上
+    template<typename T, size_t N, typename Alloc = std::allocator<T>>
+    class SmallVector : public Vector<T, detail::SmallAllocator<T, Alloc>> {
+    private:
+        static_assert(N > 0, "SmallVector needs at least one inline element");
+
+        using base = Vector<T, detail::SmallAllocator<T, Alloc>>;
+        using upstream_traits = std::allocator_traits<Alloc>;
+
+        alignas(T) unsigned char m_storage[sizeof(T) * N];
+
+        T *inline_data() noexcept {
+            return reinterpret_cast<T *>(m_storage);
+        }
+
+        // 恢复为空的内联状态，调用前必须已经释放了原有的元素和内存
+        void reset_inline() noexcept {
+            this->m_data = inline_data();
+            this->m_size = 0;
+            this->m_capacity = N;
+        }
+
+        bool same_upstream(const SmallVector &other) const noexcept {
+            return upstream_traits::is_always_equal::value ||
+                   this->alloc().upstream() == other.alloc().upstream();
+        }
+
+        // 调用前自身必须为空的内联状态
+        void take(SmallVector &other) {
+            if (!other.is_inline() && same_upstream(other)) {
+                this->m_data = other.m_data;
+                this->m_size = other.m_size;
+                this->m_capacity = other.m_capacity;
+                other.reset_inline();
+                return;
+            }
+            this->assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+            other.clear();
+        }
+
+    public:
+        using typename base::value_type;
+        using typename base::iterator;
+        using typename base::const_iterator;
+
+        explicit SmallVector(const Alloc &alloc = Alloc())
+                : base(detail::SmallAllocator<T, Alloc>(reinterpret_cast<T *>(m_storage), alloc)) {
+            reset_inline();
+        }
+
+        explicit SmallVector(size_t n, const Alloc &alloc = Alloc()) : SmallVector(alloc) {
+            this->resize(n);
+        }
+
+        SmallVector(size_t n, const T &value, const Alloc &alloc = Alloc()) : SmallVector(alloc) {
+            this->assign(n, value);
+        }
+
+        template<typename InputIt, std::enable_if_t<is_iterator_v<InputIt>, int> = 0>
+        SmallVector(InputIt first, InputIt last, const Alloc &alloc = Alloc()) : SmallVector(alloc) {
+            this->assign(first, last);
+        }
+
+        SmallVector(std::initializer_list<T> values, const Alloc &alloc = Alloc())
+                : SmallVector(values.begin(), values.end(), alloc) {}
+
+        SmallVector(const SmallVector &other)
+                : SmallVector(other.begin(), other.end(),
+                              upstream_traits::select_on_container_copy_construction(other.alloc().upstream())) {}
+
+        SmallVector(SmallVector &&other) noexcept(upstream_traits::is_always_equal::value &&
+                                                  std::is_nothrow_move_constructible_v<T>)
+                : SmallVector(other.alloc().upstream()) {
+            take(other);
+        }
+
+        SmallVector &operator=(const SmallVector &other) {
+            base::operator=(other);
+            return *this;
+        }
+
+        SmallVector &operator=(SmallVector &&other) {
+            if (this == &other) {
+                return *this;
+            }
+            if (!other.is_inline() && same_upstream(other)) {
+                this->free();
+                reset_inline();
+            } else {
+                this->clear();
+            }
+            take(other);
+            return *this;
+        }
+
+        SmallVector &operator=(std::initializer_list<T> values) {
+            this->assign(values.begin(), values.end());
+            return *this;
+        }
+
+        void swap(SmallVector &other) {
+            if (this == &other) return;
+            if (!is_inline() && !other.is_inline() && same_upstream(other)) {
+                std::swap(this->m_data, other.m_data);
+                std::swap(this->m_size, other.m_size);
+                std::swap(this->m_capacity, other.m_capacity);
+                return;
+            }
+            SmallVector temp(std::move(other));
+            other = std::move(*this);
+            *this = std::move(temp);
+        }
+
+        // 元素数量不超过 N 时搬回内联缓冲区
+        void shrink_to_fit() {
+            if (is_inline()) return;
+            if (this->m_size > N) {
+                base::shrink_to_fit();
+                return;
+            }
+            T *heap = this->m_data;
+            relocate(heap, this->m_size, inline_data());
+            instrument::reallocated<base>();
+            instrument::moved<base>(this->m_size * sizeof(T));
+            if (heap) {
+                this->deallocate(heap, this->m_capacity);
+            }
+            this->m_data = inline_data();
+            this->m_capacity = N;
+        }
+
+        bool is_inline() const noexcept {
+            return this->m_data == reinterpret_cast<const T *>(m_storage);
+        }
+
+        static constexpr size_t inline_capacity() noexcept {
+            return N;
+        }
+
+        Alloc get_allocator() const {
+            return this->alloc().upstream();
+        }
+    };
+
+} // namespace stl
+
+#endif //STL_SMALLVECTOR_HPP
@@ -0,0 +1,594 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#ifndef STL_SOAVECTOR_HPP
+#define STL_SOAVECTOR_HPP
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "GrowthPolicy.hpp"
+#include "Instrument.hpp"
+#include "Span.hpp"
+#include "Uninitialized.hpp"
+
+namespace stl {
+
+    namespace detail {
+        // 按下标访问 owner 的随机访问迭代器，解引用得到各列引用组成的 tuple
+        template<typename Owner, bool Const>
+        class SoAIterator {
+        private:
+            template<typename, bool> friend class SoAIterator;
+
+            using owner = std::conditional_t<Const, const Owner, Owner>;
+
+            owner *m_owner;
+            size_t m_index;
+
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = typename Owner::value_type;
+            using difference_type = ptrdiff_t;
+            using reference = std::conditional_t<Const, typename Owner::const_reference, typename Owner::reference>;
+
+            struct pointer {
+                reference ref;
+
+                reference *operator->() noexcept {
+                    return &ref;
+                }
+            };
+
+            SoAIterator() noexcept : m_owner(nullptr), m_index(0) {}
+
+            SoAIterator(owner *o, size_t index) noexcept : m_owner(o), m_index(index) {}
+
+            template<bool C = Const, std::enable_if_t<C, int> = 0>
+            SoAIterator(const SoAIterator<Owner, false> &other) noexcept
+                    : m_owner(other.m_owner), m_index(other.m_index) {}
+
+            size_t index() const noexcept {
+                return m_index;
+            }
+
+            reference operator*() const {
+                return (*m_owner)[m_index];
+            }
+
+            pointer operator->() const {
+                return {(*m_owner)[m_index]};
+            }
+
+            reference operator[](difference_type n) const {
+                return (*m_owner)[m_index + n];
+            }
+
+            SoAIterator &operator++() noexcept {
+                ++m_index;
+                return *this;
+            }
+
+            SoAIterator &operator--() noexcept {
+                --m_index;
+                return *this;
+            }
+
+            SoAIterator operator++(int) noexcept {
+                SoAIterator temp = *this;
+                ++m_index;
+                return temp;
+            }
+
+            SoAIterator operator--(int) noexcept {
+                SoAIterator temp = *this;
+                --m_index;
+                return temp;
+            }
+
+            SoAIterator &operator+=(difference_type n) noexcept {
+                m_index += n;
+                return *this;
+            }
+
+            SoAIterator &operator-=(difference_type n) noexcept {
+                m_index -= n;
+                return *this;
+            }
+
+            SoAIterator operator+(difference_type n) const noexcept {
+                return SoAIterator(m_owner, m_index + n);
+            }
+
+            friend SoAIterator operator+(difference_type n, const SoAIterator &iter) noexcept {
+                return iter + n;
+            }
+
+            SoAIterator operator-(difference_type n) const noexcept {
+                return SoAIterator(m_owner, m_index - n);
+            }
+
+            difference_type operator-(const SoAIterator &other) const noexcept {
+                return static_cast<difference_type>(m_index - other.m_index);
+            }
+
+            bool operator==(const SoAIterator &other) const noexcept {
+                return m_index == other.m_index;
+            }
+
+            bool operator!=(const SoAIterator &other) const noexcept {
+                return m_index != other.m_index;
+            }
+
+            bool operator<(const SoAIterator &other) const noexcept {
+                return m_index < other.m_index;
+            }
+
+            bool operator>(const SoAIterator &other) const noexcept {
+                return m_index > other.m_index;
+            }
+
+            bool operator<=(const SoAIterator &other) const noexcept {
+                return m_index <= other.m_index;
+            }
+
+            bool operator>=(const SoAIterator &other) const noexcept {
+                return m_index >= other.m_index;
+            }
+        };
+    } // namespace detail
+
+    // 按列存储的记录数组: 每个字段一列，各列连续存放在同一块内存中并按 64 字节 (缓存行) 对齐，
+    // 扩容时所有列一起搬迁，每次只分配一次。只访问一个字段的扫描只读取这一列，
+    // column<I>() 返回的 Span 可以直接交给 Simd.hpp 的算法。
+    // 按行访问返回各列引用组成的 tuple，支持结构化绑定: auto [ts, id, value] = records[i];
+    template<typename ...Fields>
+    class SoAVector {
+    private:
+        static_assert(sizeof...(Fields) > 0, "SoAVector needs at least one field");
+
+        static constexpr size_t column_align = 64;
+        static_assert(((alignof(Fields) <= column_align) && ...), "field alignment exceeds 64 bytes");
+
+        struct alignas(column_align) Chunk {
+            unsigned char bytes[column_align];
+        };
+
+        using chunk_allocator = std::allocator<Chunk>;
+        using indices = std::index_sequence_for<Fields...>;
+
+        Chunk *m_block;
+        std::tuple<Fields *...> m_columns;
+        size_t m_size;
+        size_t m_capacity;
+
+    public:
+        static constexpr size_t column_count = sizeof...(Fields);
+
+        template<size_t I>
+        using field_type = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+        using value_type = std::tuple<Fields...>;
+        using reference = std::tuple<Fields &...>;
+        using const_reference = std::tuple<const Fields &...>;
+        using iterator = detail::SoAIterator<SoAVector, false>;
+        using const_iterator = detail::SoAIterator<SoAVector, true>;
+
+        inline static const char *out_of_range = "soa vector subscript out of range";
+
+    private:
+        static constexpr size_t align_up(size_t bytes) noexcept {
+            return (bytes + column_align - 1) & ~(column_align - 1);
+        }
+
+        static size_t block_chunks(size_t capacity) noexcept {
+            return ((align_up(sizeof(Fields) * capacity)) + ...) / column_align;
+        }
+
+        template<typename T>
+        static T *take_column(unsigned char *base, size_t &offset, size_t capacity) noexcept {
+            T *column = reinterpret_cast<T *>(base + offset);
+            offset += align_up(sizeof(T) * capacity);
+            return column;
+        }
+
+        // 在 block 中依次划出各列，列的起始地址都是 64 字节对齐的
+        static std::tuple<Fields *...> carve(Chunk *block, size_t capacity) noexcept {
+            auto *base = reinterpret_cast<unsigned char *>(block);
+            size_t offset = 0;
+            return std::tuple<Fields *...>{take_column<Fields>(base, offset, capacity)...}; // 花括号内按顺序求值
+        }
+
+        static Chunk *allocate(size_t capacity) {
+            chunk_allocator alloc;
+            Chunk *block = std::allocator_traits<chunk_allocator>::allocate(alloc, block_chunks(capacity));
+            instrument::allocated<SoAVector>(block_chunks(capacity) * sizeof(Chunk));
+            return block;
+        }
+
+        static void deallocate(Chunk *block, size_t capacity) noexcept {
+            if (block == nullptr) return;
+            instrument::freed<SoAVector>(block_chunks(capacity) * sizeof(Chunk));
+            chunk_allocator alloc;
+            std::allocator_traits<chunk_allocator>::deallocate(alloc, block, block_chunks(capacity));
+        }
+
+        template<typename F, size_t ...I>
+        static void for_each_index(F &&f, std::index_sequence<I...>) {
+            (f(std::integral_constant<size_t, I>{}), ...);
+        }
+
+        // 对每一列调用 f(integral_constant<I>)
+        template<typename F>
+        static void for_each_column(F &&f) {
+            for_each_index(f, indices{});
+        }
+
+        template<size_t ...I>
+        reference row(size_t i, std::index_sequence<I...>) noexcept {
+            return reference(std::get<I>(m_columns)[i]...);
+        }
+
+        template<size_t ...I>
+        const_reference row(size_t i, std::index_sequence<I...>) const noexcept {
+            return const_reference(std::get<I>(m_columns)[i]...);
+        }
+
+        // 析构 [first, last) 行
+        void destroy_rows(size_t first, size_t last) noexcept {
+            for_each_column([&](auto c) {
+                auto *column = std::get<c>(m_columns);
+                stl::destroy(column + first, column + last);
+            });
+        }
+
+        // 在 columns 的第 i 行逐列构造，某一列失败时析构已构造的列
+        template<typename ...Args>
+        static void construct_row(std::tuple<Fields *...> &columns, size_t i, Args &&... args) {
+            construct_from(columns, i, std::forward_as_tuple(std::forward<Args>(args)...), indices{});
+        }
+
+        template<typename Tuple, size_t ...I>
+        static void construct_from(std::tuple<Fields *...> &columns, size_t i, Tuple &&values, std::index_sequence<I...>) {
+            size_t built = 0;
+            try {
+                ((::new(std::get<I>(columns) + i) Fields(std::get<I>(std::forward<Tuple>(values))), ++built), ...);
+            } catch (...) {
+                for_each_column([&](auto c) {
+                    using T = field_type<c>;
+                    if (c < built) std::get<c>(columns)[i].~T();
+                });
+                throw;
+            }
+        }
+
+        // 可能抛出异常的列 (移动构造可能抛出时改为拷贝) 先搬，失败时只需析构新内存中的副本；
+        // 其余的列之后再搬，不会失败。成功后源区间变为未初始化内存
+        void relocate_columns(std::tuple<Fields *...> &dest) {
+            size_t done = 0; // 已搬运的可能失败的列数
+            try {
+                for_each_column([&](auto c) {
+                    using T = field_type<c>;
+                    if constexpr (!is_nothrow_relocatable_v<T>) {
+                        uninitialized_move_if_noexcept(std::get<c>(m_columns), m_size, std::get<c>(dest));
+                        ++done;
+                    }
+                });
+            } catch (...) {
+                size_t k = 0;
+                for_each_column([&](auto c) {
+                    using T = field_type<c>;
+                    if constexpr (!is_nothrow_relocatable_v<T>) {
+                        if (k++ < done) stl::destroy(std::get<c>(dest), std::get<c>(dest) + m_size);
+                    }
+                });
+                throw;
+            }
+            for_each_column([&](auto c) {
+                using T = field_type<c>;
+                if constexpr (is_nothrow_relocatable_v<T>) {
+                    relocate(std::get<c>(m_columns), m_size, std::get<c>(dest));
+                } else {
+                    stl::destroy(std::get<c>(m_columns), std::get<c>(m_columns) + m_size);
+                }
+            });
+            instrument::moved<SoAVector>(m_size * (sizeof(Fields) + ...));
+        }
+
+        void reallocate(size_t capacity) {
+            Chunk *block = allocate(capacity);
+            auto columns = carve(block, capacity);
+            try {
+                relocate_columns(columns);
+            } catch (...) {
+                deallocate(block, capacity);
+                throw;
+            }
+            instrument::reallocated<SoAVector>();
+            deallocate(m_block, m_capacity);
+            m_block = block;
+            m_columns = columns;
+            m_capacity = capacity;
+        }
+
+        // 容量已满时先在新内存中构造新行 (参数可能引用自身的元素)，再搬迁旧数据
+        template<typename ...Args>
+        void realloc_emplace_back(Args &&... args) {
+            const size_t capacity = DoublingGrowth::grow(m_capacity, m_size + 1, (sizeof(Fields) + ...));
+            Chunk *block = allocate(capacity);
+            auto columns = carve(block, capacity);
+            try {
+                construct_row(columns, m_size, std::forward<Args>(args)...);
+            } catch (...) {
+                deallocate(block, capacity);
+                throw;
+            }
+            try {
+                relocate_columns(columns);
+            } catch (...) {
+                for_each_column([&](auto c) {
+                    using T = field_type<c>;
+                    std::get<c>(columns)[m_size].~T();
+                });
+                deallocate(block, capacity);
+                throw;
+            }
+            instrument::reallocated<SoAVector>();
+            deallocate(m_block, m_capacity);
+            m_block = block;
+            m_columns = columns;
+            m_capacity = capacity;
+        }
+
+        void free() noexcept {
+            destroy_rows(0, m_size);
+            deallocate(m_block, m_capacity);
+            m_block = nullptr;
+            m_columns = std::tuple<Fields *...>{};
+            m_size = m_capacity = 0;
+        }
+
+    public:
+        SoAVector() noexcept : m_block(nullptr), m_columns(), m_size(0), m_capacity(0) {}
+
+        explicit SoAVector(size_t n) : SoAVector() {
+            resize(n);
+        }
+
+        SoAVector(std::initializer_list<value_type> rows) : SoAVector() {
+            reserve(rows.size());
+            for (const value_type &r : rows) push_back(r);
+        }
+
+        SoAVector(const SoAVector &other) : SoAVector() {
+            reserve(other.m_size);
+            size_t done = 0;
+            try {
+                for_each_column([&](auto c) {
+                    uninitialized_copy(std::get<c>(other.m_columns), other.m_size, std::get<c>(m_columns));
+                    ++done;
+                });
+            } catch (...) {
+                size_t k = 0; // 失败的那一列由 uninitialized_copy 自行清理
+                for_each_column([&](auto c) {
+                    if (k++ < done) stl::destroy(std::get<c>(m_columns), std::get<c>(m_columns) + other.m_size);
+                });
+                throw; // m_size 仍为 0，析构函数只释放内存
+            }
+            m_size = other.m_size;
+        }
+
+        SoAVector(SoAVector &&other) noexcept
+                : m_block(other.m_block), m_columns(other.m_columns), m_size(other.m_size), m_capacity(other.m_capacity) {
+            other.m_block = nullptr;
+            other.m_columns = std::tuple<Fields *...>{};
+            other.m_size = other.m_capacity = 0;
+        }
+
+        ~SoAVector() {
+            free();
+        }
+
+        SoAVector &operator=(const SoAVector &other) {
+            if (this != &other) {
+                SoAVector temp(other);
+                swap(temp);
+            }
+            return *this;
+        }
+
+        SoAVector &operator=(SoAVector &&other) noexcept {
+            if (this != &other) {
+                free();
+                swap(other);
+            }
+            return *this;
+        }
+
+        void swap(SoAVector &other) noexcept {
+            using std::swap;
+            swap(m_block, other.m_block);
+            swap(m_columns, other.m_columns);
+            swap(m_size, other.m_size);
+            swap(m_capacity, other.m_capacity);
+        }
+
+        // 每个参数构造一列
+        template<typename ...Args, std::enable_if_t<sizeof...(Args) == sizeof...(Fields), int> = 0>
+        reference emplace_back(Args &&... args) {
+            if (m_size == m_capacity) {
+                realloc_emplace_back(std::forward<Args>(args)...);
+            } else {
+                construct_row(m_columns, m_size, std::forward<Args>(args)...);
+            }
+            return (*this)[m_size++];
+        }
+
+        void push_back(const value_type &r) {
+            std::apply([this](const Fields &... f) { emplace_back(f...); }, r);
+        }
+
+        void push_back(value_type &&r) {
+            std::apply([this](Fields &... f) { emplace_back(std::move(f)...); }, r);
+        }
+
+        void pop_back() {
+            if (m_size == 0) {
+                throw std::runtime_error("soa vector is empty");
+            }
+            --m_size;
+            destroy_rows(m_size, m_size + 1);
+        }
+
+        // 删除第 i 行，之后的行逐列前移
+        void erase(size_t i) {
+            if (i >= m_size) {
+                throw std::out_of_range(out_of_range);
+            }
+            for_each_column([&](auto c) {
+                auto *column = std::get<c>(m_columns);
+                std::move(column + i + 1, column + m_size, column + i);
+            });
+            pop_back();
+            instrument::moved<SoAVector>((m_size - i) * (sizeof(Fields) + ...));
+        }
+
+        reference operator[](size_t i) noexcept {
+            return row(i, indices{});
+        }
+
+        const_reference operator[](size_t i) const noexcept {
+            return row(i, indices{});
+        }
+
+        reference at(size_t i) {
+            if (i >= m_size) {
+                throw std::out_of_range(out_of_range);
+            }
+            return row(i, indices{});
+        }
+
+        const_reference at(size_t i) const {
+            if (i >= m_size) {
+                throw std::out_of_range(out_of_range);
+            }
+            return row(i, indices{});
+        }
+
+        // 第 I 列的连续视图
+        template<size_t I>
+        Span<field_type<I>> column() noexcept {
+            return Span<field_type<I>>(std::get<I>(m_columns), m_size);
+        }
+
+        template<size_t I>
+        Span<const field_type<I>> column() const noexcept {
+            return Span<const field_type<I>>(std::get<I>(m_columns), m_size);
+        }
+
+        template<size_t I>
+        field_type<I> *data() noexcept {
+            return std::get<I>(m_columns);
+        }
+
+        template<size_t I>
+        const field_type<I> *data() const noexcept {
+            return std::get<I>(m_columns);
+        }
+
+        void reserve(size_t n) {
+            if (n > m_capacity) {
+                reallocate(n);
+            }
+        }
+
+        void shrink_to_fit() {
+            if (m_size == m_capacity) return;
+            if (m_size == 0) {
+                free();
+            } else {
+                reallocate(m_size);
+            }
+        }
+
+        // 新增的行值初始化
+        void resize(size_t n) {
+            if (n <= m_size) {
+                destroy_rows(n, m_size);
+                m_size = n;
+                return;
+            }
+            reserve(n);
+            size_t done = 0;
+            try {
+                for_each_column([&](auto c) {
+                    uninitialized_value_construct(std::get<c>(m_columns) + m_size, n - m_size);
+                    ++done;
+                });
+            } catch (...) {
+                size_t k = 0;
+                for_each_column([&](auto c) {
+                    if (k++ < done) stl::destroy(std::get<c>(m_columns) + m_size, std::get<c>(m_columns) + n);
+                });
+                throw;
+            }
+            m_size = n;
+        }
+
+        void clear() noexcept {
+            destroy_rows(0, m_size);
+            m_size = 0;
+        }
+
+        iterator begin() noexcept {
+            return iterator(this, 0);
+        }
+
+        iterator end() noexcept {
+            return iterator(this, m_size);
+        }
+
+        const_iterator begin() const noexcept {
+            return const_iterator(this, 0);
+        }
+
+        const_iterator end() const noexcept {
+            return const_iterator(this, m_size);
+        }
+
+        size_t size() const noexcept {
+            return m_size;
+        }
+
+        size_t capacity() const noexcept {
+            return m_capacity;
+        }
+
+        bool empty() const noexcept {
+            return m_size == 0;
+        }
+
+        friend bool operator==(const SoAVector &a, const SoAVector &b) {
+            if (a.m_size != b.m_size) return false;
+            bool equal = true;
+            for_each_column([&](auto c) {
+                const auto *x = std::get<c>(a.m_columns), *y = std::get<c>(b.m_columns);
+                for (size_t i = 0; equal && i < a.m_size; ++i) equal = x[i] == y[i];
+            });
+            return equal;
+        }
+
+        friend bool operator!=(const SoAVector &a, const SoAVector &b) {
+            return !(a == b);
+        }
+    };
+
+} // namespace stl
+
+#endif //STL_SOAVECTOR_HPP
@@ -0,0 +1,98 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#ifndef STL_SPAN_HPP
+#define STL_SPAN_HPP
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+namespace stl {
+
+    // 连续元素的非拥有视图，只保存指针和长度。提供 data() 与 size()，
+    // 可以直接传给 Simd.hpp 的容器版本算法
+    template<typename T>
+    class Span {
+    private:
+        T *m_data;
+        size_t m_size;
+
+    public:
+        using element_type = T;
+        using value_type = std::remove_cv_t<T>;
+        using pointer = T *;
+        using reference = T &;
+        using iterator = T *;
+        using const_iterator = const T *;
+
+        inline static const char *out_of_range = "span subscript out of range";
+
+        Span() noexcept : m_data(nullptr), m_size(0) {}
+
+        Span(T *data, size_t size) noexcept : m_data(data), m_size(size) {}
+
+        // Span<T> 可以隐式转换为 Span<const T>
+        template<typename U, std::enable_if_t<std::is_convertible_v<U (*)[], T (*)[]>, int> = 0>
+        Span(const Span<U> &other) noexcept : m_data(other.data()), m_size(other.size()) {}
+
+        T *data() const noexcept {
+            return m_data;
+        }
+
+        size_t size() const noexcept {
+            return m_size;
+        }
+
+        bool empty() const noexcept {
+            return m_size == 0;
+        }
+
+        T *begin() const noexcept {
+            return m_data;
+        }
+
+        T *end() const noexcept {
+            return m_data + m_size;
+        }
+
+        T &operator[](size_t i) const {
+            return m_data[i];
+        }
+
+        T &at(size_t i) const {
+            if (i >= m_size) {
+                throw std::out_of_range(out_of_range);
+            }
+            return m_data[i];
+        }
+
+        T &front() const {
+            return at(0);
+        }
+
+        T &back() const {
+            return at(m_size - 1);
+        }
+
+        // [offset, offset + count)，count 超出末尾时截断
+        Span subspan(size_t offset, size_t count = size_t(-1)) const {
+            if (offset > m_size) {
+                throw std::out_of_range(out_of_range);
+            }
+            return Span(m_data + offset, count < m_size - offset ? count : m_size - offset);
+        }
+
+        Span first(size_t n) const {
+            return subspan(0, n);
+        }
+
+        Span last(size_t n) const {
+            return n > m_size ? *this : subspan(m_size - n, n);
+        }
+    };
+
+} // namespace stl
+
+#endif //STL_SPAN_HPP
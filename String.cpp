@@ -3,27 +3,48 @@
 //
 #include "String.h"
 
+#include <algorithm>
+#include <cctype>
+#include <istream>
+
 namespace stl
 {
-    String::String() : m_data(nullptr), m_size(0), m_capacity(default_capacity) {
+    String::String() : String(default_resource()) {}
+
+    // 空字符串和短字符串不分配内存
+    String::String(MemoryResource *resource) : m_resource(resource) {
         init();
     }
 
-    String::String(size_t size, char c) : m_data(nullptr), m_size(0), m_capacity(default_capacity) {
+    String::String(size_t size, char c, MemoryResource *resource) : m_resource(resource) {
+        init();
         resize(size);
-        memset(m_data, c, m_capacity);
+        memset(ptr(), c, size);
     }
 
-    String::String(const char *str) : m_data(nullptr), m_size(strlen(str)), m_capacity(default_capacity) {
-        if (m_size <= default_capacity) {
-            init();
-        } else {
-            resize(m_size);
+    String::String(const char *str, MemoryResource *resource) : String(str, strlen(str), resource) {}
+
+    // 按长度拷贝，str 中可以包含 '\0'
+    String::String(const char *str, size_t size, MemoryResource *resource) : m_resource(resource) {
+        if (str == nullptr && size) {
+            throw std::runtime_error("str is null pointer");
         }
-        strcpy(m_data, str);
+        init();
+        resize(size);
+        if (size) memcpy(ptr(), str, size);
     }
 
-    String::String(const String &other) : String(other.m_data) {}
+    String::String(StringView str, MemoryResource *resource) : String(str.data(), str.size(), resource) {}
+
+    // 与 std::pmr 一致，拷贝构造使用默认资源
+    String::String(const String &other) : String(other.ptr(), other.size()) {}
+
+    String::String(const String &other, MemoryResource *resource) : String(other.ptr(), other.size(), resource) {}
+
+    // 短字符串直接拷贝对象内的字节
+    String::String(String &&other) noexcept : m_long(other.m_long), m_resource(other.m_resource) {
+        other.init();
+    }
 
     String &String::operator=(const char *str) {
         copy(str);
@@ -34,20 +55,21 @@ namespace stl
         if (this == &str) {
             return *this;
         }
-        copy(str.m_data);
+        assign(str.ptr(), str.size());
         return *this;
     }
 
-    String &String::operator=(String &&str) noexcept {
+    String &String::operator=(String &&str) {
         if (this == &str) {
             return *this;
         }
-        delete[] m_data;
-        m_data = str.m_data;
-        m_size = str.m_size;
-        m_capacity = str.m_capacity;
-        str.m_data = nullptr;
-        str.m_size = str.m_capacity = 0;
+        if (!m_resource->is_equal(*str.m_resource)) { // 不同资源之间只能拷贝
+            assign(str.ptr(), str.size());
+            return *this;
+        }
+        destroy();
+        m_long = str.m_long;
+        str.init();
         return *this;
     }
 
@@ -55,11 +77,12 @@ namespace stl
         if (str == nullptr) {
             throw std::runtime_error("str is null pointer");
         }
-        return strcmp(m_data, str) == 0;
+        const size_t size = strlen(str);
+        return size == this->size() && memcmp(ptr(), str, size) == 0;
     }
 
     bool String::operator==(const String &str) const {
-        return m_size == str.m_size && *this == str.m_data;
+        return size() == str.size() && memcmp(ptr(), str.ptr(), size()) == 0;
     }
 
     bool String::operator!=(const char *str) const {
@@ -67,16 +90,18 @@ namespace stl
     }
 
     bool String::operator!=(const String &str) const {
-        return m_size != str.m_size || *this != str.m_data;
+        return !(*this == str);
     }
 
     String String::add(const char *str, const size_t size) const {
         if (str == nullptr) {
             throw std::runtime_error("str is null pointer");
         }
-        String result(m_size + size + 1, 0);
-        strncpy(result.m_data, m_data, m_size);
-        strcpy(result.m_data + m_size, str);
+        const size_t old_size = this->size();
+        String result(m_resource);
+        result.resize(old_size + size);
+        memcpy(result.ptr(), ptr(), old_size);
+        memcpy(result.ptr() + old_size, str, size);
         return result;
     }
 
@@ -88,43 +113,81 @@ namespace stl
     }
 
     String String::operator+(const String &str) const {
-        return add(str.m_data, str.m_size);
+        return add(str.ptr(), str.size());
     }
 
     String &String::operator+=(const char *str) {
-        append(str, strlen(str));
+        append(str);
         return *this;
     }
 
     String &String::operator+=(const String &str) {
-        append(str.m_data, str.m_size);
+        append(str.ptr(), str.size());
+        return *this;
+    }
+
+    String &String::operator+=(StringView str) {
+        append(str.data(), str.size());
         return *this;
     }
 
-    void String::init(char c) {
-        m_data = new char[m_capacity + 1];
-        memset(m_data, c, m_size);
-        m_data[m_size] = 0;
+    char *String::allocate(size_t capacity) {
+        char *data = static_cast<char *>(m_resource->allocate(capacity + 1, 1));
+        instrument::allocated<String>(capacity + 1);
+        return data;
+    }
+
+    void String::deallocate(char *data, size_t capacity) {
+        if (data != nullptr) {
+            m_resource->deallocate(data, capacity + 1, 1);
+            instrument::freed<String>(capacity + 1);
+        }
+    }
+
+    // 置为空的短字符串
+    void String::init() noexcept {
+        m_short[0] = 0;
+        m_short[sso_capacity] = static_cast<char>(sso_capacity);
+    }
+
+    void String::set_long(char *data, size_t size, size_t capacity) noexcept {
+        m_long.data = data;
+        m_long.size = size;
+        m_long.capacity = encode(capacity);
+        data[size] = 0;
+    }
+
+    // 重新分配到 capacity，保留内容
+    void String::reallocate(size_t capacity) {
+        const size_t size = this->size();
+        char *data = allocate(capacity);
+        memcpy(data, ptr(), size);
+        instrument::moved<String>(size);
+        if (is_long()) {
+            instrument::reallocated<String>();
+            deallocate(m_long.data, this->capacity());
+        }
+        set_long(data, size, capacity);
     }
 
     void String::copy(const char *str) {
         if (str == nullptr) {
             throw std::runtime_error("str pointer is null");
         }
-        resize(strlen(str));
-        strcpy(m_data, str);
+        assign(str, strlen(str));
     }
 
     void String::destroy() {
-        if (m_data != nullptr) {
-            delete[] m_data;
+        if (is_long()) {
+            deallocate(m_long.data, capacity());
         }
-        m_data = nullptr;
-        m_size = m_capacity = 0;
+        init();
     }
 
     String::~String() {
-        destroy();
+        if (is_long()) {
+            deallocate(m_long.data, capacity());
+        }
     }
 
     char& String::at(size_t index) {
@@ -132,23 +195,45 @@ namespace stl
     }
 
     const char &String::at(size_t index) const {
-        if (index >= m_size) {
+        if (index >= size()) {
             throw std::out_of_range("index out of range");
         }
-        return m_data[index];
+        return ptr()[index];
     }
 
     char &String::operator[](size_t index) const {
-        return m_data[index];
+        return const_cast<char *>(ptr())[index];
     }
 
+    // str 可以指向自身，扩容前先记下偏移
     void String::append(const char *str, size_t size) {
-        if (str == nullptr) {
+        if (str == nullptr && size) {
             throw std::out_of_range("pointer is null");
         }
-        size_t end = m_size;
-        resize(m_size + size);
-        strcpy(m_data + end, str);
+        const size_t end = this->size();
+        const char *data = ptr();
+        if (str >= data && str <= data + end) {
+            const size_t offset = str - data;
+            resize(end + size);
+            memmove(ptr() + end, ptr() + offset, size);
+            return;
+        }
+        resize(end + size);
+        if (size) memcpy(ptr() + end, str, size);
+    }
+
+    void String::assign(const char *str, size_t size) {
+        if (str == nullptr && size) {
+            throw std::out_of_range("pointer is null");
+        }
+        const char *data = ptr();
+        if (str >= data && str <= data + this->size()) { // 来自自身时只需要前移
+            memmove(ptr(), str, size);
+            set_size(size);
+            return;
+        }
+        resize(size);
+        if (size) memcpy(ptr(), str, size);
     }
 
     void String::append(const char *str) {
@@ -159,34 +244,60 @@ namespace stl
     }
 
     void String::append(const String &str) {
-        append(m_data, m_size);
+        append(str.ptr(), str.size());
     }
 
-    void String::insert(const char *str, size_t index) {
-        if (index > m_size) {
+    void String::append(StringView str) {
+        append(str.data(), str.size());
+    }
+
+    char *String::grow_by(size_t count) {
+        const size_t size = this->size();
+        resize(size + count);
+        return ptr() + size;
+    }
+
+    void String::insert(const char *str, size_t size, size_t index) {
+        const size_t old_size = this->size(); // old end
+        if (index > old_size) {
             throw std::out_of_range("insert index out of range");
         }
-        size_t size = strlen(str);
-        size_t old_size = m_size; // old end
-        resize(m_size + size);
-        memmove(m_data + index + size, m_data + index, old_size - index);
-        strncpy(m_data + index, str, size);
+        const char *data = ptr();
+        if (str >= data && str <= data + old_size) { // 来自自身时先拷贝出来
+            const String temp(str, size, m_resource);
+            insert(temp.ptr(), size, index);
+            return;
+        }
+        resize(old_size + size);
+        char *dest = ptr();
+        memmove(dest + index + size, dest + index, old_size - index);
+        instrument::moved<String>(old_size - index);
+        memcpy(dest + index, str, size);
+    }
+
+    void String::insert(const char *str, size_t index) {
+        if (str == nullptr) {
+            throw std::runtime_error("str is null pointer");
+        }
+        insert(str, strlen(str), index);
     }
 
     void String::insert(const String &str, size_t index) {
-        insert(str.m_data, index);
+        insert(str.ptr(), str.size(), index);
     }
 
     bool String::remove(size_t index, size_t count) {
-        if (index > m_size) {
+        const size_t size = this->size();
+        if (index > size) {
             return false;
         }
-        if (index + count >= m_size) {
-            m_size = index;
-            m_data[m_size] = '\0';
+        if (count >= size - index) {
+            set_size(index);
         } else {
-            m_size -= count;
-            strcpy(m_data + index, m_data + index + count);
+            char *data = ptr();
+            memmove(data + index, data + index + count, size - index - count);
+            set_size(size - count);
+            instrument::moved<String>(size - count - index);
         }
         return true;
     }
@@ -195,34 +306,43 @@ namespace stl
         if (str == nullptr) {
             throw std::runtime_error("str is null pointer");
         }
-        size_t index = strstr(m_data, str) - m_data;
-        return (index >= 0 && index < m_size) ? index : -1;
+        return detail::search(ptr(), size(), str, strlen(str), 0);
     }
 
     size_t String::find(const String &str) const {
-        return find(str.m_data);
+        return detail::search(ptr(), size(), str.ptr(), str.size(), 0);
+    }
+
+    size_t String::rfind(StringView str) const {
+        return StringView(*this).rfind(str);
+    }
+
+    size_t String::find_first_of(StringView set, size_t pos) const {
+        return StringView(*this).find_first_of(set, pos);
+    }
+
+    size_t String::count(char c) const {
+        return simd::count_char(ptr(), size(), c);
     }
 
     String String::substr(size_t index, size_t count) const {
-        if (index >= m_size || index + count > m_size) {
+        if (index >= size() || index + count > size()) {
             throw std::out_of_range("index out of range");
         }
-        String sub(count, 0);
-        strncpy(sub.m_data, m_data + index, count);
-        sub.m_data[sub.m_size] = 0;
-        return sub;
+        return String(ptr() + index, count, m_resource);
     }
 
     void String::push_back(char c) {
-        resize(m_size + 1);
-        m_data[m_size - 1] = c;
+        const size_t size = this->size();
+        resize(size + 1);
+        ptr()[size] = c;
     }
 
     void String::pop_back() {
-        if (m_size == 0) {
+        if (empty()) {
             throw std::runtime_error("String is empty");
         }
-        m_data[--m_size] = 0;
+        set_size(size() - 1);
     }
 
     char& String::front() {
@@ -230,7 +350,7 @@ namespace stl
     }
 
     char &String::back() {
-        return at(m_size - 1);
+        return at(size() - 1);
     }
 
     const char& String::front() const {
@@ -238,67 +358,47 @@ namespace stl
     }
 
     const char &String::back() const {
-        return at(m_size - 1);
+        return at(size() - 1);
+    }
+
+    void String::reserve(size_t capacity) {
+        if (capacity > this->capacity()) {
+            reallocate(capacity);
+        }
     }
 
+    // 从当前容量开始按 1.5 倍增长，逐个追加的均摊代价为常数
     void String::resize(size_t size)
     {
-        if (m_data && size <= m_capacity) {
-            m_size = size;
-            m_data[m_size] = '\0';
-            return;
-        }
-        size_t capacity = default_capacity;
-        while (capacity < size)
-        {
-            capacity += capacity / 2;
-        }
-        m_capacity = capacity;
-        const char *temp = m_data;
-        m_data = new char[m_capacity + 1];
-        if (temp != nullptr) {
-            strcpy(m_data, temp);
-            delete[] temp;
+        const size_t capacity = this->capacity();
+        if (size > capacity) {
+            reallocate(std::max(size, capacity + capacity / 2));
         }
-        m_size = size;
+        set_size(size);
     }
 
     void String::clear() {
-        if (m_data != nullptr) {
-            memset(m_data, 0, m_size);
-        }
-        m_size = 0;
+        set_size(0);
     }
 
+    // 切分得到的子串与自身使用同一个内存资源。只需要读取时用 split_view，不复制字符
     Vector<String> String::split(char delimiter) const {
+        const Vector<StringView> views = split_view(*this, delimiter);
         Vector<String> strs;
-        size_t l = 0, r = 0;
-        for (; r < m_size; ++r) {
-            if (m_data[r] == delimiter) {
-                String temp = substr(l, r - l);
-                strs.push_back(temp);
-                l = r + 1;
-            }
-
-        }
-        if (l < m_size) {
-            strs.push_back(substr(l, m_size - l));
+        strs.reverse(views.size());
+        for (const StringView view : views) {
+            strs.emplace_back(view, m_resource);
         }
         return strs;
     }
 
+    // 分隔符为空时整个字符串作为一段
     Vector<String> String::split(const String &delimiter) const {
+        const Vector<StringView> views = split_view(*this, delimiter);
         Vector<String> strs;
-        size_t l = 0, r = 0;
-        char *p = nullptr;
-        while ((p = strstr(m_data + l, delimiter.m_data)) != nullptr) {
-            // 123--456--789
-            r = p - m_data;
-            strs.push_back(substr(l, r - l));
-            l = r + delimiter.m_size;
-        }
-        if (l < m_size) {
-            strs.push_back(substr(l, m_size - l));
+        strs.reverse(views.size());
+        for (const StringView view : views) {
+            strs.emplace_back(view, m_resource);
         }
         return strs;
     }
@@ -307,40 +407,39 @@ namespace stl
         if (str == nullptr) {
             throw std::runtime_error("str is null pointer");
         }
-        size_t size = strlen(str);
-        if (size > m_size) {
-            return false;
-        }
-        for (size_t i = 0; i < size; ++i) {
-            if (m_data[i] != str[i]) {
-                return false;
-            }
-        }
-        return true;
+        const size_t size = strlen(str);
+        return size <= this->size() && memcmp(ptr(), str, size) == 0;
     }
 
     bool String::startsWith(const String &str) {
-        return str.m_size <= m_size && startsWith(str.m_data);
+        return str.size() <= size() && memcmp(ptr(), str.ptr(), str.size()) == 0;
     }
 
     void String::reverse() {
-        for (size_t i = 0, j = m_size - 1; i < j; ++i, --j) {
-            std::swap(m_data[i], m_data[j]);
+        char *data = ptr();
+        for (size_t i = 0, j = size(); i + 1 < j; ++i, --j) {
+            std::swap(data[i], data[j - 1]);
         }
     }
 
     std::ostream &operator<<(std::ostream &os, const String &str) {
-        os << str.m_data;
+        os.write(str.ptr(), static_cast<std::streamsize>(str.size()));
         return os;
     }
 
+    // 读取一个以空白分隔的词
     std::istream &operator>>(std::istream &is, String &str) {
-        char buffer[1024] = {0};
-        std::cin >> buffer;
-        str.m_size = strlen(buffer);
-        str.resize(str.m_size);
-        strcpy(str.m_data, buffer);
-        str.m_data[str.m_size] = 0;
+        str.clear();
+        std::istream::sentry sentry(is);
+        if (!sentry) {
+            return is;
+        }
+        for (int c; (c = is.peek()) != std::char_traits<char>::eof() && !std::isspace(c); is.get()) {
+            str.push_back(static_cast<char>(c));
+        }
+        if (str.empty()) {
+            is.setstate(std::ios::failbit);
+        }
         return is;
     }
 };
@@ -5,28 +5,74 @@
 #ifndef STL_STRING_H
 #define STL_STRING_H
 
+#include <cstring>
 #include <ostream>
+#include "Hash.hpp"
+#include "Instrument.hpp"
+#include "MemoryResource.hpp"
+#include "StringView.hpp"
 #include "Vector.hpp"
 
 
 namespace stl
 {
 
+    // 短字符串直接存放在对象内部 (最多 23 个字符)，只有更长的字符串才分配堆内存。
+    // 短字符串的最后一个字节保存 23 - size，长度为 23 时它正好是结尾的 '\0'；
+    // 长字符串把容量的最高位置 1 作为标记，它与短字符串的最后一个字节重合
     class String
     {
     private:
-        char *m_data;
-        size_t m_capacity;
-        size_t m_size;
-        static constexpr size_t default_capacity = 15ULL;
+        struct Long {
+            char *data;
+            size_t size;
+            size_t capacity; // 带标记位
+        };
+
+        static constexpr size_t sso_capacity = sizeof(Long) - 1;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        static constexpr size_t long_flag = 0x80;
+        static size_t encode(size_t capacity) noexcept { return capacity << 8 | long_flag; }
+        static size_t decode(size_t capacity) noexcept { return capacity >> 8; }
+#else
+        static constexpr size_t long_flag = size_t(1) << 63;
+        static size_t encode(size_t capacity) noexcept { return capacity | long_flag; }
+        static size_t decode(size_t capacity) noexcept { return capacity & ~long_flag; }
+#endif
+
+        union {
+            Long m_long;
+            char m_short[sizeof(Long)];
+        };
+        MemoryResource *m_resource; // 字符缓冲区的内存来源
+
+        bool is_long() const noexcept {
+            return static_cast<unsigned char>(m_short[sso_capacity]) & 0x80;
+        }
+
+        char *ptr() noexcept { return is_long() ? m_long.data : m_short; }
+        const char *ptr() const noexcept { return is_long() ? m_long.data : m_short; }
+
+        // 修改长度并写入结尾的 '\0'，要求 size <= capacity()
+        void set_size(size_t size) noexcept {
+            if (is_long()) {
+                m_long.size = size;
+            } else {
+                m_short[sso_capacity] = static_cast<char>(sso_capacity - size);
+            }
+            ptr()[size] = 0;
+        }
 
     private:
-        void init(char c = 0);
+        char *allocate(size_t capacity);
+        void deallocate(char *data, size_t capacity);
+        void init() noexcept;
+        void set_long(char *data, size_t size, size_t capacity) noexcept;
         void copy(const char *str);
         void destroy();
+        void reallocate(size_t capacity);
         void resize(size_t size);
         String add(const char *str, size_t size) const;
-        void append(const char *str, size_t size);
 
     public:
         using value_type = char;
@@ -37,13 +83,21 @@ namespace stl
         using iterator = char *;
         using const_iterator = const char *;
 
+        static constexpr size_t npos = size_t(-1);
+
         String();
-        String(size_t size, char c);
-        String(const char *str);
+        explicit String(MemoryResource *resource);
+        String(size_t size, char c, MemoryResource *resource = default_resource());
+        String(const char *str, MemoryResource *resource = default_resource());
+        String(const char *str, size_t size, MemoryResource *resource = default_resource());
+        explicit String(StringView str, MemoryResource *resource = default_resource());
         String(const String &other);
+        String(const String &other, MemoryResource *resource);
+        String(String &&other) noexcept;
         String &operator=(const char *str);
         String &operator=(const String &str);
-        String &operator=(String &&str) noexcept;
+        // 资源不同时退化为拷贝，可能分配内存，因此不是 noexcept (与 std::pmr::string 一致)
+        String &operator=(String &&str);
         bool operator==(const char *str) const;
         bool operator!=(const char *str) const;
         bool operator==(const String &str) const;
@@ -56,16 +110,26 @@ namespace stl
         char &back();
         const char &front() const;
         const char &back() const;
-        const char *data() const { return m_data; }
-        const char *c_str() const { return m_data; }
+        const char *data() const { return ptr(); }
+        const char *c_str() const { return ptr(); }
+        operator StringView() const noexcept { return StringView(ptr(), size()); }
         void clear();
+        void reserve(size_t capacity);
+        void assign(const char *str, size_t size); // 容量足够时不重新分配
         void append(const char *str);
+        void append(const char *str, size_t size); // 按长度追加，可以包含 '\0'
         void append(const String &str);
+        void append(StringView str);
+        char *grow_by(size_t count); // 末尾增加 count 个未初始化的字符，返回新增部分的起始位置
         void insert(const char *str, size_t index);
+        void insert(const char *str, size_t size, size_t index);
         void insert(const String &str, size_t index);
         bool remove(size_t index, size_t count);
-        size_t find(const char *str) const;
+        size_t find(const char *str) const; // 找不到时返回 npos
         size_t find(const String &str) const;
+        size_t rfind(StringView str) const;
+        size_t find_first_of(StringView set, size_t pos = 0) const;
+        size_t count(char c) const;
         String substr(size_t index, size_t count) const;
         void push_back(char c);
         void pop_back();
@@ -73,19 +137,43 @@ namespace stl
         String operator+(const String &str) const;
         String &operator+=(const char *str);
         String &operator+=(const String &str);
+        String &operator+=(StringView str);
         Vector<String> split(char delimiter) const;
         Vector<String> split(const String &delimiter) const;
         bool startsWith(const char *str);
         bool startsWith(const String &str);
-        iterator begin() const { return m_data; }
-        iterator end() const { return m_data + m_size; }
+        iterator begin() const { return const_cast<char *>(ptr()); }
+        iterator end() const { return begin() + size(); }
         void reverse();
-        size_t size() const { return m_size; }
-        bool empty() const { return m_size == 0; }
-        size_t capacity() const { return m_capacity; }
+        size_t size() const { return is_long() ? m_long.size : sso_capacity - m_short[sso_capacity]; }
+        bool empty() const { return size() == 0; }
+        size_t capacity() const { return is_long() ? decode(m_long.capacity) : sso_capacity; }
+        MemoryResource *resource() const { return m_resource; }
         friend std::ostream &operator<<(std::ostream &os, const String &str);
         friend std::istream &operator>>(std::istream &is, String &str);
     };
+
+    // String 不保存指向自身的指针 (短字符串的 data() 每次重新计算)，可以直接按字节搬运
+    template<>
+    struct is_trivially_relocatable<String> : std::true_type {};
+
+    // 按内容散列。HashMap<String, V> 可以直接用 const char * 或 StringView 查找，不必构造临时 String
+    template<>
+    struct Hash<String> {
+        using is_transparent = void;
+
+        size_t operator()(const String &str) const noexcept {
+            return static_cast<size_t>(hash_bytes(str.data(), str.size()));
+        }
+
+        size_t operator()(const char *str) const noexcept {
+            return static_cast<size_t>(hash_bytes(str, std::strlen(str)));
+        }
+
+        size_t operator()(StringView str) const noexcept {
+            return static_cast<size_t>(hash_bytes(str.data(), str.size()));
+        }
+    };
 }; // namespace stl
 
 
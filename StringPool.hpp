@@ -0,0 +1,278 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#ifndef STL_STRINGPOOL_HPP
+#define STL_STRINGPOOL_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+#include "ConcurrentVector.hpp"
+#include "Hash.hpp"
+#include "MemoryResource.hpp"
+#include "StringView.hpp"
+
+namespace stl {
+
+    class StringPool;
+
+    namespace detail {
+        // 池中的一个字符串，字符 (带结尾的 '\0') 紧跟在 16 字节的头部之后
+        struct AtomEntry {
+            uint64_t hash;
+            uint32_t size;
+            uint32_t id;
+
+            const char *data() const noexcept {
+                return reinterpret_cast<const char *>(this + 1);
+            }
+        };
+    } // namespace detail
+
+    // 池中字符串的句柄，只有一个指针大小。同一个池中内容相同的字符串得到同一个 Atom，
+    // 因此相等比较只比较指针；散列值在入池时已经算好。
+    // 默认构造的 Atom 不指向任何字符串，它的内容视为空串。不同池的 Atom 之间不能比较
+    class Atom {
+    private:
+        friend class StringPool;
+
+        const detail::AtomEntry *m_entry;
+
+        explicit Atom(const detail::AtomEntry *entry) noexcept : m_entry(entry) {}
+
+    public:
+        Atom() noexcept : m_entry(nullptr) {}
+
+        const char *c_str() const noexcept { return m_entry ? m_entry->data() : ""; }
+
+        const char *data() const noexcept { return c_str(); }
+
+        size_t size() const noexcept { return m_entry ? m_entry->size : 0; }
+
+        bool empty() const noexcept { return size() == 0; }
+
+        // 入池的顺序编号，可以用 StringPool::atom(id) 换回 Atom
+        size_t id() const noexcept { return m_entry ? m_entry->id : size_t(-1); }
+
+        uint64_t hash() const noexcept { return m_entry ? m_entry->hash : hash_bytes("", 0); }
+
+        StringView view() const noexcept { return StringView(c_str(), size()); }
+
+        operator StringView() const noexcept { return view(); }
+
+        // 是否指向池中的字符串
+        explicit operator bool() const noexcept { return m_entry != nullptr; }
+
+        friend bool operator==(Atom a, Atom b) noexcept { return a.m_entry == b.m_entry; }
+
+        friend bool operator!=(Atom a, Atom b) noexcept { return a.m_entry != b.m_entry; }
+
+        // 按入池顺序排序，不是字典序
+        friend bool operator<(Atom a, Atom b) noexcept { return a.id() + 1 < b.id() + 1; }
+
+        friend std::ostream &operator<<(std::ostream &os, Atom atom) {
+            return os << atom.view();
+        }
+    };
+
+    template<>
+    struct Hash<Atom> {
+        size_t operator()(Atom atom) const noexcept {
+            return static_cast<size_t>(atom.hash());
+        }
+    };
+
+    // 字符串驻留池: 内容相同的字符串只保存一份，字符放在单调增长的内存池中，直到池析构才释放。
+    //
+    // find / intern 的查找不加锁: 散列表的槽位是原子指针，条目写完之后才发布到槽位中。
+    // 插入新字符串时才加锁；扩容时新表建好后再替换，旧表保留到池析构，正在读旧表的线程不受影响
+    // (旧表的总大小不超过当前表)。atom(id) 同样可以与插入并发调用
+    class StringPool {
+    public:
+        struct Stats {
+            size_t atoms = 0;           // 不同字符串的个数
+            size_t interns = 0;         // intern 调用次数
+            size_t requested_bytes = 0; // 所有 intern 调用传入的字符数之和
+            size_t stored_bytes = 0;    // 池中实际保存的字符数 (不含结尾的 '\0')
+            size_t memory_bytes = 0;    // 条目、散列表和编号表占用的内存
+
+            // 与每次调用各自保存一份相比节省的字节数
+            size_t saved_bytes() const noexcept {
+                return requested_bytes > memory_bytes ? requested_bytes - memory_bytes : 0;
+            }
+        };
+
+    private:
+        using Entry = detail::AtomEntry;
+
+        struct Table {
+            Table *m_prev; // 被替换下来的旧表
+            size_t m_mask;
+
+            std::atomic<const Entry *> *slots() noexcept {
+                return reinterpret_cast<std::atomic<const Entry *> *>(this + 1);
+            }
+        };
+
+        static constexpr size_t initial_capacity = 64;
+
+        MemoryResource *m_upstream;
+        MonotonicArena m_arena;
+        std::atomic<Table *> m_table;
+        ConcurrentVector<const Entry *> m_atoms;
+        mutable std::mutex m_mutex;
+        size_t m_stored_bytes;  // 以下三项由 m_mutex 保护
+        size_t m_entry_bytes;
+        size_t m_table_bytes;
+        std::atomic<size_t> m_interns;
+        std::atomic<size_t> m_requested_bytes;
+
+        static size_t table_bytes(size_t capacity) noexcept {
+            return sizeof(Table) + capacity * sizeof(std::atomic<const Entry *>);
+        }
+
+        Table *new_table(size_t capacity, Table *prev) {
+            auto *table = static_cast<Table *>(m_upstream->allocate(table_bytes(capacity), alignof(Table)));
+            table->m_prev = prev;
+            table->m_mask = capacity - 1;
+            for (size_t i = 0; i < capacity; ++i) {
+                new(table->slots() + i) std::atomic<const Entry *>(nullptr);
+            }
+            m_table_bytes += table_bytes(capacity);
+            return table;
+        }
+
+        static bool matches(const Entry *entry, uint64_t hash, StringView str) noexcept {
+            return entry->hash == hash && entry->size == str.size() &&
+                   std::memcmp(entry->data(), str.data(), str.size()) == 0;
+        }
+
+        // 线性探测，找不到时返回 nullptr
+        static const Entry *lookup(Table *table, uint64_t hash, StringView str) noexcept {
+            for (size_t i = static_cast<size_t>(hash) & table->m_mask;; i = (i + 1) & table->m_mask) {
+                const Entry *entry = table->slots()[i].load(std::memory_order_acquire);
+                if (entry == nullptr) return nullptr;
+                if (matches(entry, hash, str)) return entry;
+            }
+        }
+
+        // 调用者需持有 m_mutex，entry 不在表中
+        static void place(Table *table, const Entry *entry) noexcept {
+            size_t i = static_cast<size_t>(entry->hash) & table->m_mask;
+            while (table->slots()[i].load(std::memory_order_relaxed) != nullptr) {
+                i = (i + 1) & table->m_mask;
+            }
+            table->slots()[i].store(entry, std::memory_order_release);
+        }
+
+        // 负载超过 1/2 时容量翻倍，调用者需持有 m_mutex
+        Table *grow(Table *table) {
+            Table *bigger = new_table((table->m_mask + 1) * 2, table);
+            for (size_t i = 0, n = m_atoms.size(); i < n; ++i) {
+                place(bigger, m_atoms[i]);
+            }
+            m_table.store(bigger, std::memory_order_release);
+            return bigger;
+        }
+
+        Atom insert(uint64_t hash, StringView str) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            Table *table = m_table.load(std::memory_order_relaxed);
+            if (const Entry *entry = lookup(table, hash, str)) { // 加锁前可能已被其他线程插入
+                return Atom(entry);
+            }
+            if (str.size() > UINT32_MAX || m_atoms.size() >= UINT32_MAX) {
+                throw std::length_error("string pool limit exceeded");
+            }
+            // 先扩容再发布新条目，扩容失败时 m_atoms 中不会留下不在任何表中的条目
+            if ((m_atoms.size() + 1) * 2 > table->m_mask + 1) {
+                table = grow(table);
+            }
+            const size_t bytes = sizeof(Entry) + str.size() + 1;
+            auto *entry = static_cast<Entry *>(m_arena.allocate(bytes, alignof(Entry)));
+            entry->hash = hash;
+            entry->size = static_cast<uint32_t>(str.size());
+            entry->id = static_cast<uint32_t>(m_atoms.size());
+            char *data = const_cast<char *>(entry->data());
+            if (!str.empty()) std::memcpy(data, str.data(), str.size());
+            data[str.size()] = 0;
+            m_atoms.push_back(entry);
+            m_stored_bytes += str.size();
+            m_entry_bytes += bytes;
+            place(table, entry);
+            return Atom(entry);
+        }
+
+    public:
+        explicit StringPool(MemoryResource *upstream = default_resource())
+                : m_upstream(upstream), m_arena(4096, upstream), m_table(nullptr), m_stored_bytes(0),
+                  m_entry_bytes(0), m_table_bytes(0), m_interns(0), m_requested_bytes(0) {
+            m_table.store(new_table(initial_capacity, nullptr), std::memory_order_relaxed);
+        }
+
+        StringPool(const StringPool &) = delete;
+
+        StringPool &operator=(const StringPool &) = delete;
+
+        // 池中所有的 Atom 随之失效
+        ~StringPool() {
+            for (Table *table = m_table.load(std::memory_order_relaxed); table;) {
+                Table *prev = table->m_prev;
+                m_upstream->deallocate(table, table_bytes(table->m_mask + 1), alignof(Table));
+                table = prev;
+            }
+        }
+
+        // 返回与 str 内容相同的 Atom，第一次出现时复制一份到池中
+        Atom intern(StringView str) {
+            m_interns.fetch_add(1, std::memory_order_relaxed);
+            m_requested_bytes.fetch_add(str.size(), std::memory_order_relaxed);
+            const uint64_t hash = hash_bytes(str.data(), str.size());
+            if (const Entry *entry = lookup(m_table.load(std::memory_order_acquire), hash, str)) {
+                return Atom(entry);
+            }
+            return insert(hash, str);
+        }
+
+        // 只查找不插入，池中没有时返回空的 Atom
+        Atom find(StringView str) const noexcept {
+            const uint64_t hash = hash_bytes(str.data(), str.size());
+            return Atom(lookup(m_table.load(std::memory_order_acquire), hash, str));
+        }
+
+        bool contains(StringView str) const noexcept {
+            return static_cast<bool>(find(str));
+        }
+
+        // 按编号取回 Atom，id 必须来自本池已经返回的 Atom
+        Atom atom(size_t id) const noexcept {
+            return Atom(m_atoms[id]);
+        }
+
+        // 不同字符串的个数
+        size_t size() const noexcept {
+            return m_atoms.size();
+        }
+
+        // 与插入并发调用时得到的是近似值
+        Stats stats() const {
+            Stats stats;
+            stats.interns = m_interns.load(std::memory_order_relaxed);
+            stats.requested_bytes = m_requested_bytes.load(std::memory_order_relaxed);
+            std::lock_guard<std::mutex> lock(m_mutex);
+            stats.atoms = m_atoms.size();
+            stats.stored_bytes = m_stored_bytes;
+            stats.memory_bytes = m_entry_bytes + m_table_bytes + m_atoms.capacity() * sizeof(const Entry *);
+            return stats;
+        }
+    };
+
+} // namespace stl
+
+#endif //STL_STRINGPOOL_HPP
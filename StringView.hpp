@@ -0,0 +1,513 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#ifndef STL_STRINGVIEW_HPP
+#define STL_STRINGVIEW_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+#include "Hash.hpp"
+#include "Simd.hpp"
+#include "Vector.hpp"
+
+namespace stl {
+
+    namespace detail {
+
+        // 逆序访问 [end - n, end)，用于从后向前查找
+        struct ReverseBytes {
+            const unsigned char *end;
+
+            unsigned char operator[](size_t i) const noexcept {
+                return *(end - 1 - i);
+            }
+        };
+
+        // Two-Way 的临界分解：返回分解位置，period 为右半部分的周期
+        template<typename Bytes>
+        size_t critical_factorization(const Bytes &x, size_t m, size_t &period) noexcept {
+            size_t suffix = size_t(-1), j = 0, k = 1, p = 1;
+            while (j + k < m) {
+                const unsigned char a = x[j + k], b = x[suffix + k];
+                if (a < b) {
+                    j += k;
+                    k = 1;
+                    p = j - suffix;
+                } else if (a == b) {
+                    if (k != p) {
+                        ++k;
+                    } else {
+                        j += p;
+                        k = 1;
+                    }
+                } else {
+                    suffix = j++;
+                    k = p = 1;
+                }
+            }
+            period = p;
+            // 再按相反的字典序求一次，取较大的分解位置
+            size_t suffix_rev = size_t(-1), q = 1;
+            j = 0;
+            k = 1;
+            while (j + k < m) {
+                const unsigned char a = x[j + k], b = x[suffix_rev + k];
+                if (b < a) {
+                    j += k;
+                    k = 1;
+                    q = j - suffix_rev;
+                } else if (a == b) {
+                    if (k != q) {
+                        ++k;
+                    } else {
+                        j += q;
+                        k = 1;
+                    }
+                } else {
+                    suffix_rev = j++;
+                    k = q = 1;
+                }
+            }
+            if (suffix_rev + 1 < suffix + 1) return suffix + 1;
+            period = q;
+            return suffix_rev + 1;
+        }
+
+        // Two-Way 查找 (Crochemore-Perrin)，O(n + m) 时间。与 glibc 相同，先用窗口末尾字节查移位表，
+        // 末尾字节不匹配时可以跳过最多 m 个位置。要求 1 <= m <= n，找不到时返回 n
+        template<typename Bytes>
+        size_t two_way(const Bytes &text, size_t n, const Bytes &pattern, size_t m) noexcept {
+            size_t shift_table[256];
+            for (size_t &shift : shift_table) shift = m;
+            for (size_t i = 0; i < m; ++i) shift_table[pattern[i]] = m - i - 1;
+
+            size_t period;
+            const size_t suffix = critical_factorization(pattern, m, period);
+            bool periodic = true;
+            for (size_t i = 0; i < suffix; ++i) {
+                if (pattern[i] != pattern[i + period]) {
+                    periodic = false;
+                    break;
+                }
+            }
+            size_t j = 0;
+            if (periodic) {
+                // 失配时只能移动一个周期，记住右半部分已经匹配的长度
+                size_t memory = 0;
+                while (j <= n - m) {
+                    size_t shift = shift_table[text[j + m - 1]];
+                    if (shift > 0) {
+                        if (memory && shift < period) {
+                            shift = m - period;
+                        }
+                        memory = 0;
+                        j += shift;
+                        continue;
+                    }
+                    size_t i = suffix > memory ? suffix : memory;
+                    while (i < m - 1 && pattern[i] == text[i + j]) ++i;
+                    if (i < m - 1) {
+                        j += i - suffix + 1;
+                        memory = 0;
+                        continue;
+                    }
+                    i = suffix - 1;
+                    while (memory < i + 1 && pattern[i] == text[i + j]) --i;
+                    if (i + 1 < memory + 1) return j;
+                    j += period;
+                    memory = m - period;
+                }
+            } else {
+                period = (suffix > m - suffix ? suffix : m - suffix) + 1;
+                while (j <= n - m) {
+                    const size_t shift = shift_table[text[j + m - 1]];
+                    if (shift > 0) {
+                        j += shift;
+                        continue;
+                    }
+                    size_t i = suffix;
+                    while (i < m - 1 && pattern[i] == text[i + j]) ++i;
+                    if (i < m - 1) {
+                        j += i - suffix + 1;
+                        continue;
+                    }
+                    i = suffix - 1;
+                    while (i != size_t(-1) && pattern[i] == text[i + j]) --i;
+                    if (i == size_t(-1)) return j;
+                    j += period;
+                }
+            }
+            return n;
+        }
+
+        // 短模式串用 SIMD 首尾字节过滤，长模式串用 Two-Way 保证线性时间
+        inline constexpr size_t two_way_threshold = 32;
+
+        // 在 [text, text + n) 中从 pos 开始查找长度为 m 的子串
+        inline size_t search(const char *text, size_t n, const char *pattern, size_t m, size_t pos) noexcept {
+            if (pos > n || m > n - pos) {
+                return size_t(-1);
+            }
+            if (m == 0) {
+                return pos;
+            }
+            const size_t length = n - pos;
+            const size_t r = m <= two_way_threshold
+                             ? simd::search(text + pos, length, pattern, m)
+                             : two_way(reinterpret_cast<const unsigned char *>(text + pos), length,
+                                       reinterpret_cast<const unsigned char *>(pattern), m);
+            return r == length ? size_t(-1) : r + pos;
+        }
+
+        // 起点不超过 pos 的最后一次出现
+        inline size_t search_last(const char *text, size_t n, const char *pattern, size_t m, size_t pos) noexcept {
+            if (m > n) {
+                return size_t(-1);
+            }
+            const size_t limit = pos < n - m ? pos : n - m; // 最后一个可能的起点
+            if (m == 0) {
+                return limit;
+            }
+            const size_t length = limit + m;
+            if (m <= two_way_threshold) {
+                const size_t r = simd::search_last(text, length, pattern, m);
+                return r == length ? size_t(-1) : r;
+            }
+            const ReverseBytes reversed_text{reinterpret_cast<const unsigned char *>(text + length)};
+            const ReverseBytes reversed_pattern{reinterpret_cast<const unsigned char *>(pattern + m)};
+            const size_t r = two_way(reversed_text, length, reversed_pattern, m);
+            return r == length ? size_t(-1) : length - r - m;
+        }
+
+        inline bool is_space(char c) noexcept {
+            return c == ' ' || (c >= '\t' && c <= '\r');
+        }
+
+    } // namespace detail
+
+    // 字符序列的非拥有视图，只保存指针和长度，可以包含 '\0'。
+    // 视图不延长源字符串的生命周期，源字符串修改、移动 (短字符串存放在对象内部) 或销毁后视图失效
+    class StringView {
+    private:
+        const char *m_data;
+        size_t m_size;
+
+    public:
+        using value_type = char;
+        using pointer = const char *;
+        using const_pointer = const char *;
+        using reference = const char &;
+        using const_reference = const char &;
+        using iterator = const char *;
+        using const_iterator = const char *;
+
+        static constexpr size_t npos = size_t(-1);
+
+        inline static const char *out_of_range = "string view subscript out of range";
+
+        constexpr StringView() noexcept : m_data(nullptr), m_size(0) {}
+
+        StringView(const char *str) : m_data(str), m_size(std::strlen(str)) {}
+
+        constexpr StringView(const char *str, size_t size) noexcept : m_data(str), m_size(size) {}
+
+        constexpr const char *data() const noexcept {
+            return m_data;
+        }
+
+        constexpr size_t size() const noexcept {
+            return m_size;
+        }
+
+        constexpr bool empty() const noexcept {
+            return m_size == 0;
+        }
+
+        constexpr const char *begin() const noexcept {
+            return m_data;
+        }
+
+        constexpr const char *end() const noexcept {
+            return m_data + m_size;
+        }
+
+        constexpr const char &operator[](size_t i) const noexcept {
+            return m_data[i];
+        }
+
+        const char &at(size_t i) const {
+            if (i >= m_size) {
+                throw std::out_of_range(out_of_range);
+            }
+            return m_data[i];
+        }
+
+        const char &front() const {
+            return at(0);
+        }
+
+        const char &back() const {
+            return at(m_size - 1);
+        }
+
+        void remove_prefix(size_t n) noexcept {
+            m_data += n;
+            m_size -= n;
+        }
+
+        void remove_suffix(size_t n) noexcept {
+            m_size -= n;
+        }
+
+        // [pos, pos + count)，count 超出末尾时截断
+        StringView substr(size_t pos, size_t count = npos) const {
+            if (pos > m_size) {
+                throw std::out_of_range(out_of_range);
+            }
+            return StringView(m_data + pos, count < m_size - pos ? count : m_size - pos);
+        }
+
+        // 按无符号字节比较，前缀较短的在前
+        int compare(StringView other) const noexcept {
+            const size_t n = m_size < other.m_size ? m_size : other.m_size;
+            const int result = n ? std::memcmp(m_data, other.m_data, n) : 0;
+            if (result != 0) return result;
+            return m_size < other.m_size ? -1 : m_size > other.m_size ? 1 : 0;
+        }
+
+        bool starts_with(StringView prefix) const noexcept {
+            return prefix.m_size <= m_size && std::memcmp(m_data, prefix.m_data, prefix.m_size) == 0;
+        }
+
+        bool starts_with(char c) const noexcept {
+            return m_size && m_data[0] == c;
+        }
+
+        bool ends_with(StringView suffix) const noexcept {
+            return suffix.m_size <= m_size &&
+                   std::memcmp(m_data + m_size - suffix.m_size, suffix.m_data, suffix.m_size) == 0;
+        }
+
+        bool ends_with(char c) const noexcept {
+            return m_size && m_data[m_size - 1] == c;
+        }
+
+        size_t find(StringView str, size_t pos = 0) const noexcept {
+            return detail::search(m_data, m_size, str.m_data, str.m_size, pos);
+        }
+
+        size_t find(char c, size_t pos = 0) const noexcept {
+            if (pos >= m_size) return npos;
+            const size_t i = simd::find_char(m_data + pos, m_size - pos, c);
+            return i == m_size - pos ? npos : i + pos;
+        }
+
+        // 起点不超过 pos 的最后一次出现
+        size_t rfind(StringView str, size_t pos = npos) const noexcept {
+            return detail::search_last(m_data, m_size, str.m_data, str.m_size, pos);
+        }
+
+        size_t rfind(char c, size_t pos = npos) const noexcept {
+            return detail::search_last(m_data, m_size, &c, 1, pos);
+        }
+
+        // 第一个属于 set 的字符
+        size_t find_first_of(StringView set, size_t pos = 0) const noexcept {
+            if (pos >= m_size) return npos;
+            const size_t i = simd::find_first_of(m_data + pos, m_size - pos, set.m_data, set.m_size);
+            return i == m_size - pos ? npos : i + pos;
+        }
+
+        size_t count(char c) const noexcept {
+            return simd::count_char(m_data, m_size, c);
+        }
+
+        bool contains(StringView str) const noexcept {
+            return find(str) != npos;
+        }
+
+        bool contains(char c) const noexcept {
+            return find(c) != npos;
+        }
+
+        // 去掉两端的空白字符 (空格、\t、\n、\v、\f、\r)
+        StringView trim_left() const noexcept {
+            size_t i = 0;
+            while (i < m_size && detail::is_space(m_data[i])) ++i;
+            return StringView(m_data + i, m_size - i);
+        }
+
+        StringView trim_right() const noexcept {
+            size_t n = m_size;
+            while (n > 0 && detail::is_space(m_data[n - 1])) --n;
+            return StringView(m_data, n);
+        }
+
+        StringView trim() const noexcept {
+            return trim_left().trim_right();
+        }
+
+        friend bool operator==(StringView a, StringView b) noexcept {
+            return a.m_size == b.m_size && (a.m_size == 0 || std::memcmp(a.m_data, b.m_data, a.m_size) == 0);
+        }
+
+        friend bool operator!=(StringView a, StringView b) noexcept {
+            return !(a == b);
+        }
+
+        friend bool operator<(StringView a, StringView b) noexcept {
+            return a.compare(b) < 0;
+        }
+
+        friend bool operator<=(StringView a, StringView b) noexcept {
+            return a.compare(b) <= 0;
+        }
+
+        friend bool operator>(StringView a, StringView b) noexcept {
+            return a.compare(b) > 0;
+        }
+
+        friend bool operator>=(StringView a, StringView b) noexcept {
+            return a.compare(b) >= 0;
+        }
+
+        friend std::ostream &operator<<(std::ostream &os, StringView str) {
+            return os.write(str.m_data, static_cast<std::streamsize>(str.m_size));
+        }
+    };
+
+    // 按分隔符切分，与 String::split 的规则相同：保留中间的空段，忽略末尾的空段。
+    // 返回的视图指向 text 的内存，不复制字符
+    inline Vector<StringView> split_view(StringView text, char delimiter) {
+        Vector<StringView> parts;
+        size_t l = 0;
+        for (size_t r; (r = text.find(delimiter, l)) != StringView::npos; l = r + 1) {
+            parts.emplace_back(text.data() + l, r - l);
+        }
+        if (l < text.size()) {
+            parts.emplace_back(text.data() + l, text.size() - l);
+        }
+        return parts;
+    }
+
+    // 分隔符为空时整个字符串作为一段
+    inline Vector<StringView> split_view(StringView text, StringView delimiter) {
+        Vector<StringView> parts;
+        size_t l = 0;
+        if (!delimiter.empty()) {
+            for (size_t r; (r = text.find(delimiter, l)) != StringView::npos; l = r + delimiter.size()) {
+                parts.emplace_back(text.data() + l, r - l);
+            }
+        }
+        if (l < text.size()) {
+            parts.emplace_back(text.data() + l, text.size() - l);
+        }
+        return parts;
+    }
+
+    // tokenize 的结果：按需逐个产生词，不分配内存
+    class TokenRange {
+    private:
+        StringView m_text;
+        StringView m_delimiters;
+
+    public:
+        class iterator {
+        private:
+            StringView m_rest;       // 当前词之后尚未处理的部分
+            StringView m_token;
+            StringView m_delimiters;
+            bool m_end;
+
+            bool is_delimiter(char c) const noexcept {
+                return std::memchr(m_delimiters.data(), c, m_delimiters.size()) != nullptr;
+            }
+
+            void advance() noexcept {
+                size_t i = 0;
+                while (i < m_rest.size() && is_delimiter(m_rest[i])) ++i;
+                if (i == m_rest.size()) {
+                    m_end = true;
+                    return;
+                }
+                size_t j = m_rest.find_first_of(m_delimiters, i);
+                if (j == StringView::npos) j = m_rest.size();
+                m_token = StringView(m_rest.data() + i, j - i);
+                m_rest.remove_prefix(j);
+            }
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = StringView;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const StringView *;
+            using reference = const StringView &;
+
+            iterator() noexcept : m_end(true) {}
+
+            iterator(StringView text, StringView delimiters) noexcept
+                    : m_rest(text), m_delimiters(delimiters), m_end(false) {
+                advance();
+            }
+
+            const StringView &operator*() const noexcept {
+                return m_token;
+            }
+
+            const StringView *operator->() const noexcept {
+                return &m_token;
+            }
+
+            iterator &operator++() noexcept {
+                advance();
+                return *this;
+            }
+
+            iterator operator++(int) noexcept {
+                iterator temp = *this;
+                advance();
+                return temp;
+            }
+
+            // 未结束的迭代器按当前词的位置比较
+            bool operator==(const iterator &other) const noexcept {
+                return m_end == other.m_end && (m_end || m_token.data() == other.m_token.data());
+            }
+
+            bool operator!=(const iterator &other) const noexcept {
+                return !(*this == other);
+            }
+        };
+
+        TokenRange(StringView text, StringView delimiters) noexcept : m_text(text), m_delimiters(delimiters) {}
+
+        iterator begin() const noexcept {
+            return iterator(m_text, m_delimiters);
+        }
+
+        iterator end() const noexcept {
+            return iterator();
+        }
+    };
+
+    // 按 delimiters 中的任意字符切分，跳过空词，例如 tokenize(line, " \t")
+    inline TokenRange tokenize(StringView text, StringView delimiters) noexcept {
+        return TokenRange(text, delimiters);
+    }
+
+    template<>
+    struct Hash<StringView> {
+        using is_transparent = void;
+
+        size_t operator()(StringView str) const noexcept {
+            return static_cast<size_t>(hash_bytes(str.data(), str.size()));
+        }
+    };
+
+} // namespace stl
+
+#endif //STL_STRINGVIEW_HPP
@@ -0,0 +1,141 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#ifndef STL_UNINITIALIZED_HPP
+#define STL_UNINITIALIZED_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace stl {
+
+    // 可平凡重定位: 把对象按字节搬到新地址后，旧地址上的对象无需析构
+    // 自定义类型可以特化该模板来开启 memcpy/memmove 搬运:
+    //     template<> struct stl::is_trivially_relocatable<MyType> : std::true_type {};
+    template<typename T>
+    struct is_trivially_relocatable : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+    template<typename T>
+    inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+    // 重定位过程不会抛出异常
+    template<typename T>
+    inline constexpr bool is_nothrow_relocatable_v = is_trivially_relocatable_v<T> ||
+            (std::is_nothrow_move_constructible_v<T> && std::is_nothrow_destructible_v<T>);
+
+    template<typename T>
+    void destroy(T *first, T *last) noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (; first != last; ++first) {
+                first->~T();
+            }
+        }
+    }
+
+    // 值初始化 [first, first + n)，平凡类型的循环会被编译器优化为 memset
+    template<typename T>
+    void uninitialized_value_construct(T *first, size_t n) {
+        size_t i = 0;
+        try {
+            for (; i < n; ++i) {
+                ::new(first + i) T();
+            }
+        } catch (...) {
+            destroy(first, first + i);
+            throw;
+        }
+    }
+
+    // 默认初始化 [first, first + n)，平凡类型不做任何事，内存保持未初始化
+    template<typename T>
+    void uninitialized_default_construct(T *first, size_t n) {
+        if constexpr (!std::is_trivially_default_constructible_v<T>) {
+            size_t i = 0;
+            try {
+                for (; i < n; ++i) {
+                    ::new(first + i) T;
+                }
+            } catch (...) {
+                destroy(first, first + i);
+                throw;
+            }
+        }
+    }
+
+    // 把连续的 [src, src + n) 拷贝到未初始化内存 dest 处，两者不能重叠
+    template<typename T>
+    T *uninitialized_copy(const T *src, size_t n, T *dest) {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (n) std::memcpy(static_cast<void *>(dest), static_cast<const void *>(src), sizeof(T) * n);
+        } else {
+            size_t i = 0;
+            try {
+                for (; i < n; ++i) {
+                    ::new(dest + i) T(src[i]);
+                }
+            } catch (...) {
+                destroy(dest, dest + i);
+                throw;
+            }
+        }
+        return dest + n;
+    }
+
+    // 将 [first, first + n) 移动 (移动构造可能抛异常时改为拷贝) 到未初始化内存 dest 处，源对象保持存活
+    // 抛出异常时析构 dest 中已构造的对象
+    template<typename T>
+    T *uninitialized_move_if_noexcept(T *first, size_t n, T *dest) {
+        if constexpr (is_trivially_relocatable_v<T>) {
+            if (n) std::memcpy(static_cast<void *>(dest), static_cast<const void *>(first), sizeof(T) * n);
+        } else {
+            size_t i = 0;
+            try {
+                for (; i < n; ++i) {
+                    ::new(dest + i) T(std::move_if_noexcept(first[i]));
+                }
+            } catch (...) {
+                destroy(dest, dest + i);
+                throw;
+            }
+        }
+        return dest + n;
+    }
+
+    // 将 [first, first + n) 重定位到与之不重叠的未初始化内存 dest 处 (强异常安全)
+    // 成功后源区间变为未初始化内存；失败时源区间不变
+    template<typename T>
+    void relocate(T *first, size_t n, T *dest) {
+        uninitialized_move_if_noexcept(first, n, dest);
+        if constexpr (!is_trivially_relocatable_v<T>) {
+            destroy(first, first + n);
+        }
+    }
+
+    // 同一块内存中将 [first, first + n) 重定位到 dest，区间可以重叠
+    // 要求 is_nothrow_relocatable_v<T>，否则中途抛异常会留下空洞
+    template<typename T>
+    void relocate_overlap(T *first, size_t n, T *dest) noexcept {
+        static_assert(is_nothrow_relocatable_v<T>, "relocate_overlap requires nothrow relocation");
+        if (first == dest || n == 0) return;
+        if constexpr (is_trivially_relocatable_v<T>) {
+            std::memmove(static_cast<void *>(dest), static_cast<const void *>(first), sizeof(T) * n);
+        } else if (dest < first) {
+            for (size_t i = 0; i < n; ++i) {
+                ::new(dest + i) T(std::move(first[i]));
+                first[i].~T();
+            }
+        } else {
+            for (size_t i = n; i-- > 0;) {
+                ::new(dest + i) T(std::move(first[i]));
+                first[i].~T();
+            }
+        }
+    }
+
+} // namespace stl
+
+#endif //STL_UNINITIALIZED_HPP
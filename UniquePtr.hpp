@@ -7,6 +7,8 @@
 
 #include <cstddef>
 #include <algorithm>
+#include "Instrument.hpp"
+#include "Uninitialized.hpp"
 
 namespace stl {
 
@@ -15,38 +17,51 @@ namespace stl {
     private:
         T* m_ptr;
 
+        template <typename U>
+        friend class UniquePtr;
+
     public:
         UniquePtr(std::nullptr_t = nullptr) : m_ptr(nullptr) {}
 
-        explicit UniquePtr(T* ptr) : m_ptr(ptr) {}
+        // 接管 ptr 时记为一次分配，对象被删除或通过 release 交出时记为释放
+        explicit UniquePtr(T* ptr) : m_ptr(ptr) {
+            if (ptr) instrument::allocated<UniquePtr>(sizeof(T));
+        }
 
-        UniquePtr(UniquePtr&& other) { m_ptr = other.release(); }
+        UniquePtr(UniquePtr&& other) noexcept : m_ptr(other.m_ptr) { other.m_ptr = nullptr; }
 
+        // 所有权在指针之间转移，不经过 release，不计入分配和释放
         template <typename U>
-        UniquePtr(UniquePtr<U>&& ptr) {
-            m_ptr = ptr.release();
-        }
+        UniquePtr(UniquePtr<U>&& ptr) noexcept : m_ptr(ptr.m_ptr) { ptr.m_ptr = nullptr; }
 
         template <typename U>
-        UniquePtr& operator=(UniquePtr<U>&& ptr) {
-            reset(ptr.release());
+        UniquePtr& operator=(UniquePtr<U>&& ptr) noexcept {
+            reset();
+            m_ptr = ptr.m_ptr;
+            ptr.m_ptr = nullptr;
             return *this;
         }
 
-        UniquePtr& operator=(std::nullptr_t) { reset(nullptr); }
+        UniquePtr& operator=(std::nullptr_t) {
+            reset(nullptr);
+            return *this;
+        }
 
         UniquePtr(const UniquePtr& other) = delete;
 
         UniquePtr& operator=(const UniquePtr& other) = delete;
 
-        UniquePtr& operator=(UniquePtr&& other) {
-            m_ptr = other.release();
+        UniquePtr& operator=(UniquePtr&& other) noexcept {
+            if (this != &other) {
+                reset();
+                m_ptr = other.m_ptr;
+                other.m_ptr = nullptr;
+            }
             return *this;
         }
 
         ~UniquePtr() {
-            delete m_ptr;
-            m_ptr = nullptr;
+            reset();
         }
 
         T* get() const { return m_ptr; }
@@ -56,16 +71,20 @@ namespace stl {
         T& operator*() const { return *m_ptr; }
 
         void reset(T* ptr = nullptr) {
-            if (m_ptr) delete m_ptr;
+            T* old = m_ptr;
             m_ptr = ptr;
+            if (ptr) instrument::allocated<UniquePtr>(sizeof(T));
+            if (old) {
+                instrument::freed<UniquePtr>(sizeof(T));
+                delete old;
+            }
         }
 
+        // 交出所有权，不删除对象
         T* release() {
             T* ptr = m_ptr;
-            if (m_ptr) {
-                delete m_ptr;
-                m_ptr = nullptr;
-            }
+            if (ptr) instrument::freed<UniquePtr>(sizeof(T));
+            m_ptr = nullptr;
             return ptr;
         }
 
@@ -75,5 +94,8 @@ namespace stl {
 
         explicit operator bool() const { return m_ptr != nullptr; }
     };
+
+    template<typename T>
+    struct is_trivially_relocatable<UniquePtr<T>> : std::true_type {};
 }
 #endif //STL_UNIQUEPTR_HPP
@@ -5,8 +5,11 @@
 #ifndef STL_UTILITY_H
 #define STL_UTILITY_H
 
+#include <cstdio>
 #include <iostream>
+#include <memory>
 #include <string>
+#include <type_traits>
 
 template<typename T>
 using iterator_t = typename std::iterator_traits<T>::iterator_category;
@@ -17,6 +20,34 @@ inline constexpr bool is_iterator_v = false;
 template<typename T>
 inline constexpr bool is_iterator_v<T, std::void_t<iterator_t<T>>> = true;
 
+// 比较或散列函数是否接受与键不同的类型 (异构查找)
+template<typename T, typename = void>
+inline constexpr bool is_transparent_v = false;
+
+template<typename T>
+inline constexpr bool is_transparent_v<T, std::void_t<typename T::is_transparent>> = true;
+
+namespace stl {
+    namespace detail {
+        // 关联容器共用的异构查找规则: Key 就是 K 或 Fn (比较或散列函数) 透明时直接查找，
+        // 其他可转换为 K 的类型先转换一次再查找
+        template<typename K, typename Fn, typename Key>
+        inline constexpr bool direct_lookup_v = std::is_same_v<Key, K> || is_transparent_v<Fn>;
+
+        template<typename K, typename Fn, typename Key>
+        inline constexpr bool lookup_arg_v = direct_lookup_v<K, Fn, Key> || std::is_convertible_v<const Key &, K>;
+
+        template<typename K, typename Fn, typename Key>
+        decltype(auto) lookup_key(const Key &key) {
+            if constexpr (direct_lookup_v<K, Fn, Key>) {
+                return (key);
+            } else {
+                return K(key);
+            }
+        }
+    } // namespace detail
+} // namespace stl
+
 template<typename T, std::enable_if_t<is_iterator_v<T>, int> = 0>
 void print(T first, T last, const std::string& name) {
     const size_t n = last - first;
@@ -40,8 +71,9 @@ void print(const T& container, const std::string& name) {
     std::cout << "}  size: " << container.size() << std::endl;
 }
 
-// std::string 的字符串格式化函数
+// std::string 的字符串格式化函数。每次调用 snprintf 两次且不检查参数类型，新代码应使用 Format.hpp 中的 stl::format
 template<typename ... Args>
+[[deprecated("use stl::format / stl::format_to from Format.hpp")]]
 static std::string str_format(const std::string &format, Args&& ... args)
 {
     // 计算格式化后字符串的长度，加 1 用来存放 C 字符串的 '\0' 终止符
@@ -5,27 +5,42 @@
 #ifndef STL_VECTOR_HPP
 #define STL_VECTOR_HPP
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <iterator>
+#include <limits>
 #include <stdexcept>
 #include <memory>
 #include <initializer_list>
 #include <type_traits>
+#include "Allocator.hpp"
+#include "GrowthPolicy.hpp"
+#include "Instrument.hpp"
+#include "Simd.hpp"
+#include "Uninitialized.hpp"
 #include "Utility.hpp"
 
 
 namespace stl {
 
-    template<typename T>
-    class Vector {
+    // 私有继承分配器: 无状态的分配器借助空基类优化不占空间
+    // Growth 为扩容策略，见 GrowthPolicy.hpp
+    template<typename T, typename Alloc = std::allocator<T>, typename Growth = DoublingGrowth>
+    class Vector : private Alloc {
     private:
+        using alloc_traits = std::allocator_traits<Alloc>;
+        static_assert(std::is_same_v<typename alloc_traits::pointer, T *>, "fancy pointers are not supported");
+
+    protected: // SmallVector 需要直接管理缓冲区
         T *m_data;
         size_t m_size;
         size_t m_capacity;
 
     public:
-        using allocator = std::allocator<T>; // 分配器，可以保证内存对齐
+        using allocator = Alloc; // 分配器，可以保证内存对齐
+        using allocator_type = Alloc;
+        using growth_policy = Growth;
 
         using value_type = T;
         using pointer = T *;
@@ -37,111 +52,293 @@ namespace stl {
 
         inline static const char *out_of_range = "vector subscript out of range";
 
-    private:
+    protected:
+
+        Alloc &alloc() noexcept {
+            return *this;
+        }
+
+        const Alloc &alloc() const noexcept {
+            return *this;
+        }
+
+        T *allocate(size_t n) {
+            T *p = alloc_traits::allocate(alloc(), n);
+            instrument::allocated<Vector>(n * sizeof(T));
+            return p;
+        }
+
+        void deallocate(T *p, size_t n) noexcept {
+            if constexpr (instrument::enabled) {
+                if (!is_inline_buffer(p)) instrument::freed<Vector>(n * sizeof(T));
+            }
+            alloc_traits::deallocate(alloc(), p, n);
+        }
+
+        // 内嵌缓冲区不是申请来的，释放时不计数
+        bool is_inline_buffer(const T *p) const noexcept {
+            if constexpr (has_is_inline_v<Alloc>) {
+                return alloc().is_inline(p);
+            } else {
+                return false;
+            }
+        }
+
+        // 元素搬到了新内存 (申请和释放另行计数)
+        void count_relocation(size_t n) const noexcept {
+            instrument::reallocated<Vector>();
+            instrument::moved<Vector>(n * sizeof(T));
+        }
+
+        // 接管 other 的内存，调用前自身必须为空
+        void steal(Vector &other) noexcept {
+            m_data = other.m_data;
+            m_size = other.m_size;
+            m_capacity = other.m_capacity;
+            other.m_data = nullptr;
+            other.m_size = other.m_capacity = 0;
+        }
 
         void free() {
             if (m_data) {
-                allocator().deallocate(m_data, m_capacity);
+                destroy(m_data, m_data + m_size);
+                deallocate(m_data, m_capacity);
             }
             m_data = nullptr;
             m_size = m_capacity = 0;
         }
 
-        // subscript range: [first, last)
+    private:
+
+        // subscript range: [first, last)，在未初始化的内存上构造
         void assign(size_t first, size_t last, const T& value) {
-            for (size_t i = first; i < last; ++i) {
-                ::new(m_data + i) T(value);
+            size_t i = first;
+            try {
+                for (; i < last; ++i) {
+                    ::new(m_data + i) T(value);
+                }
+            } catch (...) {
+                destroy(m_data + first, m_data + i);
+                throw;
             }
         }
 
         template <typename InputIt, std::enable_if_t<is_iterator_v<InputIt>, int> = 0 >
         void assign(const_iterator iter, InputIt first, InputIt last) {
-            for (size_t i = iter - m_data; first != last ; ++i, ++first) {
-                ::new(m_data + i) T(*first);
+            T *const start = m_data + (iter - m_data);
+            T *cur = start;
+            try {
+                for (; first != last; ++cur, ++first) {
+                    ::new(cur) T(*first);
+                }
+            } catch (...) {
+                destroy(start, cur);
+                throw;
             }
         }
 
         size_t increase(size_t need) const {
-            size_t new_capacity = m_capacity ? m_capacity : 1;
-            while (new_capacity < need) {
-                new_capacity <<= 1ULL; // 扩容到原来的 2 倍
-                //new_capacity = (new_capacity << 1ULL) - (new_capacity >> 1ULL); // 扩容到原来的 1.5 倍
+            return Growth::grow(m_capacity, need, sizeof(T));
+        }
+
+        static constexpr bool can_grow_in_place = has_expand_v<Alloc> ||
+                (has_reallocate_v<Alloc> && is_trivially_relocatable_v<T>);
+
+        // 借助分配器的 expand/reallocate 原地扩容，成功后元素已位于 m_data (地址可能改变)
+        bool grow_in_place(size_t new_capacity) noexcept {
+            if (m_data == nullptr) return false;
+            if constexpr (has_expand_v<Alloc>) {
+                if (alloc().expand(m_data, m_capacity, new_capacity)) {
+                    instrument::resized<Vector>(m_capacity * sizeof(T), new_capacity * sizeof(T));
+                    m_capacity = new_capacity;
+                    return true;
+                }
             }
-            return new_capacity;
+            if constexpr (has_reallocate_v<Alloc> && is_trivially_relocatable_v<T>) {
+                if (T *p = alloc().reallocate(m_data, m_capacity, new_capacity)) {
+                    instrument::resized<Vector>(m_capacity * sizeof(T), new_capacity * sizeof(T));
+                    m_data = p;
+                    m_capacity = new_capacity;
+                    return true;
+                }
+            }
+            return false;
         }
 
-        // 将 [iter, end) 处的元素移动到 iter + n 处 (腾出 n 个空间)
-        // 可能会改变 m_data
+        // 将 [iter, end) 处的元素重定位到 iter + n 处 (腾出 n 个未初始化的空间)
+        // 可能会改变 m_data；抛出异常时 Vector 保持不变
         void move_data(const_iterator iter, size_t n, bool new_memory) {
             const size_t pos = iter - m_data;
-            if (new_memory) {
-                const size_t new_capacity = increase(m_size + n);
-                T *new_data = allocator().allocate(new_capacity);
-                if (m_data) {
-                    std::memcpy(new_data, m_data, sizeof(T) * pos);
-                    std::memcpy(new_data + pos + n, m_data + pos, sizeof(T) * (m_size - pos));
-                    allocator().deallocate(m_data, m_capacity);
+            if constexpr (is_nothrow_relocatable_v<T>) {
+                if (!new_memory) {
+                    relocate_overlap(m_data + pos, m_size - pos, m_data + pos + n);
+                    instrument::moved<Vector>((m_size - pos) * sizeof(T));
+                    return;
                 }
-                m_data = new_data;
-                m_capacity = new_capacity;
-            } else {
-                std::memmove(m_data + pos + n, m_data + pos, sizeof(T) * (m_size - pos));
             }
+            const size_t new_capacity = new_memory ? increase(m_size + n) : m_capacity;
+            if constexpr (can_grow_in_place && is_nothrow_relocatable_v<T>) {
+                if (new_memory && grow_in_place(new_capacity)) {
+                    relocate_overlap(m_data + pos, m_size - pos, m_data + pos + n);
+                    instrument::moved<Vector>((m_size - pos) * sizeof(T));
+                    return;
+                }
+            }
+            // 重定位可能抛异常的类型即使容量足够也换一块内存，以保证强异常安全
+            T *new_data = allocate(new_capacity);
+            if (m_data) {
+                try {
+                    uninitialized_move_if_noexcept(m_data, pos, new_data);
+                    try {
+                        uninitialized_move_if_noexcept(m_data + pos, m_size - pos, new_data + pos + n);
+                    } catch (...) {
+                        destroy(new_data, new_data + pos);
+                        throw;
+                    }
+                } catch (...) {
+                    deallocate(new_data, new_capacity);
+                    throw;
+                }
+                if constexpr (!is_trivially_relocatable_v<T>) {
+                    destroy(m_data, m_data + m_size);
+                }
+                count_relocation(m_size);
+                deallocate(m_data, m_capacity);
+            }
+            m_data = new_data;
+            m_capacity = new_capacity;
+        }
+
+        // move_data 之后填充空间失败时调用，把 [pos + n, m_size + n) 处的元素移回 pos 处
+        void close_gap(size_t pos, size_t n) noexcept {
+            if constexpr (is_nothrow_relocatable_v<T>) {
+                relocate_overlap(m_data + pos + n, m_size - pos, m_data + pos);
+                instrument::moved<Vector>((m_size - pos) * sizeof(T));
+            } else { // 无法安全地移回，只保留 [0, pos) (基本异常安全)
+                destroy(m_data + pos + n, m_data + m_size + n);
+                m_size = pos;
+            }
+        }
+
+        // 容量已满时在尾部构造元素: 先在新内存中构造，参数引用自身元素时也是安全的
+        template<typename ...Args>
+        T &realloc_emplace_back(Args &&... args) {
+            const size_t new_capacity = increase(m_size + 1);
+            if constexpr (can_grow_in_place) {
+                if (m_data) { // 原地扩容时参数仍可能引用自身元素，先构造出来
+                    T temp(std::forward<Args>(args)...);
+                    reserve_exact(new_capacity);
+                    ::new(m_data + m_size) T(std::move(temp));
+                    return m_data[m_size++];
+                }
+            }
+            T *new_data = allocate(new_capacity);
+            try {
+                ::new(new_data + m_size) T(std::forward<Args>(args)...);
+            } catch (...) {
+                deallocate(new_data, new_capacity);
+                throw;
+            }
+            if (m_data) {
+                try {
+                    relocate(m_data, m_size, new_data);
+                } catch (...) {
+                    new_data[m_size].~T();
+                    deallocate(new_data, new_capacity);
+                    throw;
+                }
+                count_relocation(m_size);
+                deallocate(m_data, m_capacity);
+            }
+            m_data = new_data;
+            m_capacity = new_capacity;
+            return m_data[m_size++];
         }
 
     public:
 
-        Vector() : m_data(nullptr), m_size(0), m_capacity(0) {}
+        Vector() noexcept(std::is_nothrow_default_constructible_v<Alloc>)
+                : Alloc(), m_data(nullptr), m_size(0), m_capacity(0) {}
 
-        explicit Vector(const size_t n) : Vector(n, T()) {}
+        explicit Vector(const Alloc &alloc) noexcept : Alloc(alloc), m_data(nullptr), m_size(0), m_capacity(0) {}
 
-        Vector(const size_t n, const T& value) : Vector() {
+        explicit Vector(const size_t n, const Alloc &alloc = Alloc()) : Vector(alloc) {
             resize(n);
+        }
+
+        Vector(const size_t n, const T& value, const Alloc &alloc = Alloc()) : Vector(alloc) {
+            reverse(n);
             assign(0, n, value);
+            m_size = n;
         }
 
-        Vector(std::initializer_list<T> values) : Vector(values.begin(), values.end()) {}
+        Vector(std::initializer_list<T> values, const Alloc &alloc = Alloc())
+                : Vector(values.begin(), values.end(), alloc) {}
 
-        Vector(const Vector &other) : Vector(other.begin(), other.end()) {}
+        Vector(const Vector &other)
+                : Vector(other.begin(), other.end(), alloc_traits::select_on_container_copy_construction(other.alloc())) {}
 
-        Vector(Vector &&other) : m_data(other.m_data), m_size(other.m_size), m_capacity(other.m_capacity) {
-            other.m_data = nullptr;
-            other.m_size = other.m_capacity = 0;
+        Vector(const Vector &other, const Alloc &alloc) : Vector(other.begin(), other.end(), alloc) {}
+
+        Vector(Vector &&other) noexcept : Alloc(std::move(other.alloc())), m_data(nullptr), m_size(0), m_capacity(0) {
+            steal(other);
+        }
+
+        Vector(Vector &&other, const Alloc &alloc) : Vector(alloc) {
+            if (this->alloc() == other.alloc()) {
+                steal(other);
+            } else {
+                assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+            }
         }
 
         template <typename InputIt, std::enable_if_t<is_iterator_v<InputIt>, int> = 0 >
-        Vector(InputIt first, InputIt last) : Vector() {
-            resize(last - first);
+        Vector(InputIt first, InputIt last, const Alloc &alloc = Alloc()) : Vector(alloc) {
+            const size_t n = last - first;
+            reverse(n);
             assign(m_data, first, last);
+            m_size = n;
         }
 
         Vector &operator=(const Vector &other) {
             if (this == &other) {
                 return *this;
             }
+            if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+                if (alloc() != other.alloc()) { // 旧内存必须由旧分配器释放
+                    free();
+                }
+                alloc() = other.alloc();
+            }
             if (m_capacity < other.m_size) {
                 free();
                 reverse(other.m_size);
-                for (size_t i = 0; i < other.m_size; ++i) {
-                    ::new(m_data + i) T(other[i]);
-                }
+            } else {
+                clear();
             }
             assign(m_data, other.begin(), other.end());
             m_size = other.m_size;
             return *this;
         }
 
-        Vector &operator=(Vector &&other) noexcept {
+        Vector &operator=(Vector &&other) noexcept(alloc_traits::propagate_on_container_move_assignment::value ||
+                                                   alloc_traits::is_always_equal::value) {
             if (this == &other) { // 未定义行为，此处直接返回
                 return *this;
             }
-            free();
-            m_data = other.m_data;
-            m_size = other.m_size;
-            m_capacity = other.m_capacity;
-
-            other.m_data = nullptr;
-            other.m_size = other.m_capacity = 0;
+            if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+                free();
+                alloc() = std::move(other.alloc());
+                steal(other);
+            } else {
+                if (alloc() == other.alloc()) {
+                    free();
+                    steal(other);
+                } else { // 分配器不同，只能逐个移动元素
+                    assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+                    other.clear();
+                }
+            }
             return *this;
         }
 
@@ -161,9 +358,12 @@ namespace stl {
         void assign(size_t n, const T& value) {
             if (m_capacity < n) {
                 free();
+            } else {
+                clear();
             }
-            resize(n);
+            reverse(n);
             assign(0, n, value);
+            m_size = n;
         }
 
         // range: [first, last)
@@ -172,9 +372,12 @@ namespace stl {
             const size_t n = last - first;
             if (m_capacity < n) {
                 free();
+            } else {
+                clear();
             }
-            resize(n);
+            reverse(n);
             assign(begin(), first, last);
+            m_size = n;
         }
 
         void assign(std::initializer_list<T> values) {
@@ -192,32 +395,126 @@ namespace stl {
             return m_data[i];
         }
 
+        // 容量至少为 n，实际容量由扩容策略的 fit 决定，容量足够时什么也不做
         void reverse(size_t n) {
             if (m_capacity < n) {
-                T* new_data = allocator().allocate(n);
+                reserve_exact(Growth::fit(n, sizeof(T)));
+            }
+        }
+
+        // 容量恰好扩到 n，不经过扩容策略
+        void reserve_exact(size_t n) {
+            if (m_capacity < n) {
+                if (grow_in_place(n)) {
+                    return;
+                }
+                T* new_data = allocate(n);
                 if (m_data) {
-                    std::memcpy(new_data, m_data, sizeof(T) * m_size);
-                    allocator().deallocate(m_data, m_capacity);
+                    try {
+                        relocate(m_data, m_size, new_data);
+                    } catch (...) {
+                        deallocate(new_data, n);
+                        throw;
+                    }
+                    count_relocation(m_size);
+                    deallocate(m_data, m_capacity);
                 }
                 m_data = new_data;
                 m_capacity = n;
-            } else if (m_size > n) {
-                assign(n, m_size, T());
             }
         }
 
         void resize(size_t n) {
-            reverse(n);
+            if (n > m_size) {
+                reverse(n);
+                uninitialized_value_construct(m_data + m_size, n - m_size);
+            } else {
+                destroy(m_data + n, m_data + m_size);
+            }
             m_size = n;
         }
 
+        void resize(size_t n, const T &value) {
+            if (n > m_size) {
+                insert(end(), n - m_size, value);
+            } else {
+                destroy(m_data + n, m_data + m_size);
+                m_size = n;
+            }
+        }
+
+        // 新增的元素只做默认初始化: 平凡类型的内容保持未初始化，留给调用者直接写入 (比如 read())
+        void resize_for_overwrite(size_t n) {
+            if (n > m_size) {
+                reverse(n);
+                uninitialized_default_construct(m_data + m_size, n - m_size);
+            } else {
+                destroy(m_data + n, m_data + m_size);
+            }
+            m_size = n;
+        }
+
+        void resize_default_init(size_t n) {
+            resize_for_overwrite(n);
+        }
+
+        // 在尾部追加连续的 [ptr, ptr + n)，可平凡拷贝的类型直接 memcpy
+        void append_n(const T *ptr, size_t n) {
+            if (n == 0) return;
+            if (m_capacity - m_size < n) {
+                if (ptr >= m_data && ptr < m_data + m_size) { // 追加自身的元素，扩容后重新定位
+                    const size_t offset = ptr - m_data;
+                    reserve_exact(increase(m_size + n));
+                    ptr = m_data + offset;
+                } else {
+                    reserve_exact(increase(m_size + n));
+                }
+            }
+            uninitialized_copy(ptr, n, m_data + m_size);
+            m_size += n;
+        }
+
+        // 在尾部追加 [first, last)，来源是连续内存时退化为 append_n
+        template <typename InputIt, std::enable_if_t<is_iterator_v<InputIt>, int> = 0>
+        void append_range(InputIt first, InputIt last) {
+            using category = typename std::iterator_traits<InputIt>::iterator_category;
+            if constexpr (std::is_pointer_v<InputIt> &&
+                          std::is_same_v<std::remove_cv_t<std::remove_pointer_t<InputIt>>, T>) {
+                append_n(first, last - first);
+            } else if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+                const size_t n = std::distance(first, last);
+                if (m_capacity - m_size < n) {
+                    reserve_exact(increase(m_size + n));
+                }
+                assign(end(), first, last);
+                m_size += n;
+            } else {
+                for (; first != last; ++first) {
+                    emplace_back(*first);
+                }
+            }
+        }
+
         void shrink_to_fit() {
             if (m_size == 0) {
                 free();
-            } else {
-                T *new_data = allocator().allocate(m_size);
-                std::memcpy(new_data, m_data, sizeof(T) * m_size);
-                allocator().deallocate(m_data, m_capacity);
+            } else if (m_size < m_capacity) {
+                if constexpr (has_shrink_v<Alloc>) { // 原地归还尾部的内存，元素地址不变
+                    if (alloc().shrink(m_data, m_capacity, m_size)) {
+                        instrument::resized<Vector>(m_capacity * sizeof(T), m_size * sizeof(T));
+                        m_capacity = m_size;
+                        return;
+                    }
+                }
+                T *new_data = allocate(m_size);
+                try {
+                    relocate(m_data, m_size, new_data);
+                } catch (...) {
+                    deallocate(new_data, m_size);
+                    throw;
+                }
+                count_relocation(m_size);
+                deallocate(m_data, m_capacity);
                 m_data = new_data;
                 m_capacity = m_size;
             }
@@ -228,45 +525,49 @@ namespace stl {
         }
 
         void push_back(const T &value) {
-            if (m_capacity > m_size) {
-                ::new(m_data + m_size) T(value);
-                ++m_size;
-                return;
-            }
-            reverse(increase(m_size + 1));
-            ::new(m_data + m_size) T(value);
-            ++m_size;
+            emplace_back(value);
         }
 
         void push_back(T &&value) {
-            if (m_capacity > m_size) {
-                ::new (m_data + m_size) T(std::move(value));
-                return;
-            }
-            reverse(increase(m_size + 1));
-            ::new (m_data + m_size) T(std::move(value));
-            ++m_size;
+            emplace_back(std::move(value));
         }
 
         template<typename ... Args, std::enable_if_t<std::is_constructible_v<T, Args&&...>, int> = 0>
         T& emplace(const_iterator iter, Args &&... args) {
-            if (iter > end()) {
+            if (iter < begin() || iter > end()) {
                 throw std::runtime_error("Iterator out of range");
             }
+            if (iter == end()) {
+                return emplace_back(std::forward<Args>(args)...);
+            }
             const size_t pos = iter - m_data;
+            T temp(std::forward<Args>(args)...); // 参数可能引用自身元素，先构造出来再腾挪
             move_data(iter, 1ULL, m_size == m_capacity);
+            try {
+                // placement new (定位 new 或 布置 new : 在指定内存地址出原地构造)
+                ::new(m_data + pos) T(std::move(temp));
+            } catch (...) {
+                close_gap(pos, 1ULL);
+                throw;
+            }
             ++m_size;
-            // placement new (定位 new 或 布置 new : 在指定内存地址出原地构造)
-            ::new(m_data + pos) T(std::forward<Args>(args)...);
             return m_data[pos];
         }
 
         template<typename ...Args, std::enable_if_t<std::is_constructible_v<T, Args&&...>, int> = 0>
         T& emplace_back(Args &&... args) {
-            return emplace(end(), args...);
+            if (m_size < m_capacity) {
+                ::new(m_data + m_size) T(std::forward<Args>(args)...);
+                return m_data[m_size++];
+            }
+            return realloc_emplace_back(std::forward<Args>(args)...);
         }
 
-        void swap(Vector &other) {
+        // 不传播分配器时要求两者的分配器相等
+        void swap(Vector &other) noexcept {
+            if constexpr (alloc_traits::propagate_on_container_swap::value) {
+                std::swap(alloc(), other.alloc());
+            }
             std::swap(m_data, other.m_data);
             std::swap(m_size, other.m_size);
             std::swap(m_capacity, other.m_capacity);
@@ -277,7 +578,7 @@ namespace stl {
                 throw std::runtime_error("vector is empty");
             }
             --m_size;
-            ::new(m_data + m_size) T();
+            m_data[m_size].~T();
         }
 
         T &front() {
@@ -317,70 +618,67 @@ namespace stl {
         void erase(const_iterator first, const_iterator last) {
             if (first == last) return;
             if (first > last) throw std::runtime_error("first is greater than last");
-            if (first >= m_size) throw std::runtime_error("first out of range");
-            if (last > m_size) throw std::runtime_error("last out of range");
-            const size_t diff = last - first;
-            std::memmove(const_cast<iterator>(first), last, sizeof(T) * (end() - last));
-            assign(m_size - diff, m_size, T());
+            if (first < begin() || first >= end()) throw std::runtime_error("first out of range");
+            if (last > end()) throw std::runtime_error("last out of range");
+            const size_t pos = first - m_data, diff = last - first;
+            if constexpr (is_nothrow_relocatable_v<T>) {
+                destroy(m_data + pos, m_data + pos + diff);
+                relocate_overlap(m_data + pos + diff, m_size - pos - diff, m_data + pos);
+            } else {
+                std::move(m_data + pos + diff, m_data + m_size, m_data + pos);
+                destroy(m_data + m_size - diff, m_data + m_size);
+            }
+            instrument::moved<Vector>((m_size - pos - diff) * sizeof(T));
+            m_size -= diff;
         }
 
         void insert(const_iterator iter, const T &value) {
-            insert(iter, 1ULL, value);
+            emplace(iter, value);
         }
 
         void insert(const_iterator iter, T &&value) {
-            if (iter > end()) {
-                throw std::runtime_error("insert Iterator out of range");
-            }
-            const size_t pos = iter - m_data;
-            move_data(iter, 1ULL, m_size == m_capacity);
-            ::new(m_data + pos) T(std::move(value));
-            ++m_size;
+            emplace(iter, std::move(value));
         }
 
-
         void insert(const_iterator iter, size_t n, const T &value) {
-            if (iter > end()) {
+            if (iter < begin() || iter > end()) {
                 throw std::runtime_error("insert Iterator out of range");
             }
-            size_t pos = iter - m_data;
-            const bool new_memory = m_size == m_capacity;
-            move_data(iter, n, new_memory);
-            assign(pos, pos + n, value);
+            if (n == 0) return;
+            const size_t pos = iter - m_data;
+            const T temp(value); // value 可能是自身的元素
+            move_data(iter, n, m_capacity - m_size < n);
+            try {
+                assign(pos, pos + n, temp);
+            } catch (...) {
+                close_gap(pos, n);
+                throw;
+            }
             m_size += n;
         }
 
-
         template <typename InputIt, std::enable_if_t<is_iterator_v<InputIt>, int> = 0>
         void insert(const_iterator iter, InputIt first, InputIt last) {
-            if (iter > end()) {
+            if (iter < begin() || iter > end()) {
                 throw std::runtime_error("insert Iterator out of range");
             }
-            size_t n = last - first, pos = iter - m_data;
-            const bool new_memory = (m_capacity - m_size) < n;
-            if constexpr (std::is_same_v<iterator, InputIt>) { // 相同类型
-                if (first >= begin() && last <= end()) { // 特殊情况，单独处理
-                    if (iter > first && iter < last) { // first < iter < last
-                        size_t pre = first - m_data, left = iter - first;
-                        move_data(iter, n, new_memory);
-                        first = m_data + pre, last = m_data + pos + n + n - left;
-                        assign(m_data + pos, first, first + left);
-                        assign(m_data + pos + left, m_data + pos + n, last);
-                    } else {
-                        size_t pre = first - m_data;
-                        move_data(iter, n, new_memory);
-                        if (iter <= first) {
-                            first = m_data + pre + n;
-                        } else {
-                            first = m_data + pre;
-                        }
-                        last = first + n;
-                        assign(m_data + pos, first, last);
-                    }
+            const size_t n = last - first, pos = iter - m_data;
+            if (n == 0) return;
+            if constexpr (std::is_same_v<iterator, InputIt> || std::is_same_v<const_iterator, InputIt>) {
+                if (first >= begin() && last <= end()) { // 插入自身的元素，先拷贝出来
+                    // 临时数组用本容器的分配器经 rebind 得到的分配器，SmallVector 由此拿到上游分配器
+                    using temp_alloc = typename alloc_traits::template rebind_alloc<T>;
+                    Vector<T, temp_alloc> temp(first, last, temp_alloc(alloc()));
+                    insert(iter, std::make_move_iterator(temp.begin()), std::make_move_iterator(temp.end()));
+                    return;
                 }
-            } else {
-                move_data(iter, n, new_memory);
+            }
+            move_data(iter, n, (m_capacity - m_size) < n);
+            try {
                 assign(m_data + pos, first, last);
+            } catch (...) {
+                close_gap(pos, n);
+                throw;
             }
             m_size += n;
         }
@@ -417,21 +715,34 @@ namespace stl {
             return m_size == 0;
         }
 
+        Alloc get_allocator() const {
+            return alloc();
+        }
+
         constexpr size_t max_size() const {
             return std::numeric_limits<size_t>::max() / sizeof(T);
         }
     };
 
-    template<typename T>
-    bool operator==(const Vector<T>& a, const Vector<T>& b) {
+    template<typename T, typename Alloc, typename Growth>
+    struct is_trivially_relocatable<Vector<T, Alloc, Growth>> : is_trivially_relocatable<Alloc> {};
+
+    template<typename T, typename Alloc, typename Growth>
+    bool operator==(const Vector<T, Alloc, Growth>& a, const Vector<T, Alloc, Growth>& b) {
         if (&a == &b) return true;
         if (a.size() != b.size()) return false;
-        for (size_t i = 0, n = a.size(); i < n; ++i) {
-            if (a[i] != b[i]) {
-                return false;
+        if constexpr (is_trivially_comparable_v<T>) {
+            return a.empty() || std::memcmp(a.data(), b.data(), sizeof(T) * a.size()) == 0;
+        } else if constexpr (simd::is_simd_type_v<T>) {
+            return simd::equal(a.data(), b.data(), a.size());
+        } else {
+            for (size_t i = 0, n = a.size(); i < n; ++i) {
+                if (a[i] != b[i]) {
+                    return false;
+                }
             }
+            return true;
         }
-        return true;
     }
 }; // namespace stl
 
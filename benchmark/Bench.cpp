@@ -0,0 +1,286 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#include "Bench.hpp"
+
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include "../Simd.hpp"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+    std::atomic<uint64_t> g_allocations{0};
+    std::atomic<uint64_t> g_bytes{0};
+
+    void *counted_alloc(size_t size, size_t align = 0) noexcept {
+        g_allocations.fetch_add(1, std::memory_order_relaxed);
+        g_bytes.fetch_add(size, std::memory_order_relaxed);
+        if (size == 0) size = 1;
+        if (align > alignof(std::max_align_t)) {
+            void *p = nullptr;
+            return ::posix_memalign(&p, align, size) == 0 ? p : nullptr;
+        }
+        return std::malloc(size);
+    }
+
+    void *counted_alloc_or_throw(size_t size, size_t align = 0) {
+        if (void *p = counted_alloc(size, align)) return p;
+        throw std::bad_alloc();
+    }
+
+    // 进程内共享的一组计数器，以 cycles 为组长同时启停
+    class PerfGroup {
+    private:
+        int m_fds[bench::counter_count] = {-1, -1, -1, -1};
+        bool m_ok = false;
+
+    public:
+        PerfGroup() {
+#if defined(__linux__)
+            const uint64_t configs[bench::counter_count] = {
+                    PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                    PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+            for (size_t i = 0; i < bench::counter_count; ++i) {
+                perf_event_attr attr{};
+                attr.size = sizeof(attr);
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.config = configs[i];
+                attr.disabled = i == 0;
+                attr.exclude_kernel = 1;
+                attr.exclude_hv = 1;
+                attr.read_format = PERF_FORMAT_GROUP;
+                m_fds[i] = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, i == 0 ? -1 : m_fds[0], 0));
+                if (m_fds[i] < 0) {
+                    close_all();
+                    return;
+                }
+            }
+            ::ioctl(m_fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            m_ok = ::ioctl(m_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP) == 0;
+#endif
+        }
+
+        ~PerfGroup() {
+            close_all();
+        }
+
+        void close_all() noexcept {
+#if defined(__linux__)
+            for (int &fd : m_fds) {
+                if (fd >= 0) ::close(fd);
+                fd = -1;
+            }
+#endif
+            m_ok = false;
+        }
+
+        bool ok() const noexcept {
+            return m_ok;
+        }
+
+        void read(uint64_t *values) const noexcept {
+#if defined(__linux__)
+            if (m_ok) {
+                uint64_t buffer[1 + bench::counter_count];
+                if (::read(m_fds[0], buffer, sizeof(buffer)) == static_cast<ssize_t>(sizeof(buffer))) {
+                    std::memcpy(values, buffer + 1, sizeof(uint64_t) * bench::counter_count);
+                    return;
+                }
+            }
+#endif
+            std::memset(values, 0, sizeof(uint64_t) * bench::counter_count);
+        }
+    };
+
+    PerfGroup &perf() {
+        static PerfGroup group;
+        return group;
+    }
+
+    void write_json_string(std::ostream &out, const std::string &str) {
+        out << '"';
+        for (const char c : str) {
+            if (c == '"' || c == '\\') out << '\\';
+            out << c;
+        }
+        out << '"';
+    }
+
+    std::string base_name(const char *path) {
+        const char *slash = std::strrchr(path, '/');
+        return slash ? slash + 1 : path;
+    }
+
+} // namespace
+
+void *operator new(size_t size) {
+    return counted_alloc_or_throw(size);
+}
+
+void *operator new[](size_t size) {
+    return counted_alloc_or_throw(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+    return counted_alloc(size);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept {
+    return counted_alloc(size);
+}
+
+void *operator new(size_t size, std::align_val_t align) {
+    return counted_alloc_or_throw(size, static_cast<size_t>(align));
+}
+
+void *operator new[](size_t size, std::align_val_t align) {
+    return counted_alloc_or_throw(size, static_cast<size_t>(align));
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+
+void operator delete[](void *p) noexcept { std::free(p); }
+
+void operator delete(void *p, size_t) noexcept { std::free(p); }
+
+void operator delete[](void *p, size_t) noexcept { std::free(p); }
+
+void operator delete(void *p, std::align_val_t) noexcept { std::free(p); }
+
+void operator delete[](void *p, std::align_val_t) noexcept { std::free(p); }
+
+void operator delete(void *p, size_t, std::align_val_t) noexcept { std::free(p); }
+
+void operator delete[](void *p, size_t, std::align_val_t) noexcept { std::free(p); }
+
+namespace bench {
+
+    Sample State::now() {
+        Sample s;
+        perf().read(s.counters);
+        s.allocations = g_allocations.load(std::memory_order_relaxed);
+        s.bytes = g_bytes.load(std::memory_order_relaxed);
+        s.ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        return s;
+    }
+
+    void State::start() {
+        if (m_running) return;
+        m_running = true;
+        m_start = now();
+    }
+
+    void State::stop() {
+        if (!m_running) return;
+        const Sample end = now();
+        m_running = false;
+        m_total.ns += end.ns - m_start.ns;
+        m_total.allocations += end.allocations - m_start.allocations;
+        m_total.bytes += end.bytes - m_start.bytes;
+        for (size_t i = 0; i < counter_count; ++i) {
+            m_total.counters[i] += end.counters[i] - m_start.counters[i];
+        }
+    }
+
+    Runner::Runner(int argc, char **argv) : m_executable(base_name(argv[0])), m_min_ns(200e6) {
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (arg.rfind("--filter=", 0) == 0) {
+                m_filter = arg.substr(9);
+            } else if (arg.rfind("--min-time=", 0) == 0) {
+                m_min_ns = std::strtod(arg.c_str() + 11, nullptr) * 1e6;
+            } else if (arg.rfind("--out=", 0) == 0) {
+                m_out = arg.substr(6);
+            } else {
+                std::fprintf(stderr, "usage: %s [--filter=<substr>] [--min-time=<ms>] [--out=<path>]\n", argv[0]);
+                std::exit(2);
+            }
+        }
+    }
+
+    bool Runner::selected(const Case &c) const {
+        if (m_filter.empty()) return true;
+        const std::string full = c.name + "/" + c.impl + "/" + c.type + "/" + std::to_string(c.size);
+        return full.find(m_filter) != std::string::npos;
+    }
+
+    void Runner::report(const Result &result) const {
+        const double ops = static_cast<double>(result.calls) * static_cast<double>(result.info.ops);
+        std::FILE *out = m_out.empty() ? stderr : stdout;
+        std::fprintf(out, "%-24s %-4s %-8s %9zu %12.2f ns/op %9.3f allocs/op\n",
+                     result.info.name.c_str(), result.info.impl.c_str(), result.info.type.c_str(),
+                     result.info.size, result.total.ns / ops, static_cast<double>(result.total.allocations) / ops);
+    }
+
+    int Runner::finish() const {
+        std::ostringstream json;
+        char date[32];
+        const std::time_t t = std::time(nullptr);
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&t));
+        json << "{\"context\":{\"executable\":";
+        write_json_string(json, m_executable);
+        json << ",\"date\":\"" << date << "\",\"compiler\":";
+#if defined(__clang__)
+        write_json_string(json, std::string("clang ") + __clang_version__);
+#else
+        write_json_string(json, std::string("gcc ") + __VERSION__);
+#endif
+        json << ",\"isa\":\"" << stl::simd::isa_name(stl::simd::detected_isa()) << '"'
+             << ",\"perf_counters\":" << (perf().ok() ? "true" : "false") << "},\"benchmarks\":[";
+        for (size_t i = 0; i < m_results.size(); ++i) {
+            const Result &r = m_results[i];
+            const double ops = static_cast<double>(r.calls) * static_cast<double>(r.info.ops);
+            if (i) json << ',';
+            json << "{\"name\":";
+            write_json_string(json, r.info.name);
+            json << ",\"impl\":";
+            write_json_string(json, r.info.impl);
+            json << ",\"type\":";
+            write_json_string(json, r.info.type);
+            json << ",\"size\":" << r.info.size
+                 << ",\"iterations\":" << static_cast<uint64_t>(ops)
+                 << ",\"ns_per_op\":" << r.total.ns / ops
+                 << ",\"allocs_per_op\":" << static_cast<double>(r.total.allocations) / ops
+                 << ",\"bytes_per_op\":" << static_cast<double>(r.total.bytes) / ops;
+            for (size_t k = 0; k < counter_count; ++k) {
+                json << ",\"" << counter_names[k] << "_per_op\":";
+                if (perf().ok()) {
+                    json << static_cast<double>(r.total.counters[k]) / ops;
+                } else {
+                    json << "null";
+                }
+            }
+            json << '}';
+        }
+        json << "]}\n";
+
+        if (m_out.empty()) {
+            std::cout << json.str();
+            return std::cout ? 0 : 1;
+        }
+        std::ofstream file(m_out);
+        file << json.str();
+        if (!file) {
+            std::fprintf(stderr, "cannot write %s: %s\n", m_out.c_str(), std::strerror(errno));
+            return 1;
+        }
+        return 0;
+    }
+
+} // namespace bench
@@ -0,0 +1,124 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+
+#ifndef STL_BENCH_HPP
+#define STL_BENCH_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// 基准测试的公共部分: 计时、通过替换全局 operator new 统计分配次数、
+// 通过 perf_event_open 读取硬件计数器 (不可用时输出 null)，结果以 JSON 输出以便比较不同的运行。
+//
+// 每个可执行文件接受以下参数:
+//     --filter=<子串>    只运行名称中包含该子串的用例
+//     --min-time=<毫秒>  每个用例至少计时多久，默认 200
+//     --out=<路径>       JSON 写入文件，默认写到标准输出 (此时进度写到标准错误)
+
+namespace bench {
+
+    template<typename T>
+    inline void do_not_optimize(const T &value) {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    // 硬件计数器，顺序与 counter_names 对应
+    inline constexpr size_t counter_count = 4;
+    inline constexpr const char *counter_names[counter_count] = {"cycles", "instructions", "cache_misses", "branch_misses"};
+
+    struct Sample {
+        double ns = 0;
+        uint64_t allocations = 0;
+        uint64_t bytes = 0;
+        uint64_t counters[counter_count] = {};
+    };
+
+    // 传给用例的状态，pause 与 resume 之间的代码 (准备数据等) 不计入结果
+    class State {
+    private:
+        friend class Runner;
+
+        Sample m_total;
+        Sample m_start;
+        bool m_running = false;
+
+        static Sample now();
+
+        void start();
+
+        void stop();
+
+    public:
+        void pause() {
+            stop();
+        }
+
+        void resume() {
+            start();
+        }
+    };
+
+    // 一个用例: 名称、实现 (stl / std)、元素类型、规模，以及每调用一次 body 执行的操作数
+    struct Case {
+        std::string name;
+        std::string impl;
+        std::string type;
+        size_t size;
+        size_t ops;
+    };
+
+    class Runner {
+    private:
+        struct Result {
+            Case info;
+            uint64_t calls;
+            Sample total;
+        };
+
+        std::string m_executable;
+        std::string m_filter;
+        std::string m_out;
+        double m_min_ns;
+        std::vector<Result> m_results;
+
+        bool selected(const Case &c) const;
+
+        void report(const Result &result) const;
+
+    public:
+        Runner(int argc, char **argv);
+
+        Runner(const Runner &) = delete;
+
+        Runner &operator=(const Runner &) = delete;
+
+        // 反复调用 body(state) 直到计时达到 --min-time，先调用一次预热
+        template<typename F>
+        void run(const Case &c, F &&body) {
+            if (!selected(c)) return;
+            State warmup;
+            body(warmup);
+            State state;
+            uint64_t calls = 0;
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::nanoseconds(static_cast<int64_t>(m_min_ns * 10));
+            do {
+                state.start();
+                body(state);
+                state.stop();
+                ++calls;
+            } while (state.m_total.ns < m_min_ns && std::chrono::steady_clock::now() < deadline);
+            m_results.push_back({c, calls, state.m_total});
+            report(m_results.back());
+        }
+
+        // 输出 JSON，返回进程的退出码
+        int finish() const;
+    };
+
+} // namespace bench
+
+#endif //STL_BENCH_HPP
@@ -0,0 +1,83 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+// 标志位: Vector<bool> (每个标志一字节)、std::vector<bool> 与 BitVector 的对比，
+// 包括计数、按位与以及 rank/select 查询
+//
+
+#include <random>
+#include <vector>
+#include "Bench.hpp"
+#include "../BitVector.hpp"
+#include "../Vector.hpp"
+
+using bench::Case;
+using bench::Runner;
+using bench::State;
+
+int main(int argc, char **argv) {
+    Runner runner(argc, argv);
+    for (const size_t n : {4096, 1048576, 67108864}) {
+        stl::Vector<bool> bytes(n, false), bytes2(n, false);
+        std::vector<bool> packed(n), packed2(n);
+        stl::BitVector bits(n), bits2(n);
+        std::mt19937_64 rng(n);
+        for (size_t i = 0; i < n; ++i) {
+            const uint64_t r = rng();
+            bytes[i] = packed[i] = r & 1;
+            bytes2[i] = packed2[i] = r & 2;
+            bits[i] = r & 1;
+            bits2[i] = r & 2;
+        }
+
+        runner.run({"count", "stl::Vector<bool>", "bool", n, n}, [&](State &) {
+            size_t count = 0;
+            for (size_t i = 0; i < n; ++i) count += bytes[i];
+            bench::do_not_optimize(count);
+        });
+        runner.run({"count", "std::vector<bool>", "bool", n, n}, [&](State &) {
+            size_t count = 0;
+            for (const bool b : packed) count += b;
+            bench::do_not_optimize(count);
+        });
+        runner.run({"count", "stl::BitVector", "bool", n, n}, [&](State &) {
+            bench::do_not_optimize(bits.count());
+        });
+
+        runner.run({"and", "stl::Vector<bool>", "bool", n, n}, [&](State &) {
+            for (size_t i = 0; i < n; ++i) bytes[i] = bytes[i] & bytes2[i];
+            bench::do_not_optimize(bytes.data());
+        });
+        runner.run({"and", "std::vector<bool>", "bool", n, n}, [&](State &) {
+            for (size_t i = 0; i < n; ++i) packed[i] = packed[i] && packed2[i];
+            bench::do_not_optimize(packed.size());
+        });
+        runner.run({"and", "stl::BitVector", "bool", n, n}, [&](State &) {
+            bits &= bits2;
+            bench::do_not_optimize(bits.words());
+        });
+
+        // 重新填充，使 rank/select 的结果不全为 0
+        bits.set();
+        bits.andnot(bits2);
+        const size_t ones = bits.count();
+        constexpr size_t queries = 1024;
+        runner.run({"rank_scan", "stl::BitVector", "bool", n, queries}, [&](State &) {
+            size_t sum = 0;
+            for (size_t q = 0; q < queries; ++q) sum += bits.rank(rng() % (n + 1));
+            bench::do_not_optimize(sum);
+        });
+        bits.build_index();
+        runner.run({"rank", "stl::BitVector", "bool", n, queries}, [&](State &) {
+            size_t sum = 0;
+            for (size_t q = 0; q < queries; ++q) sum += bits.rank(rng() % (n + 1));
+            bench::do_not_optimize(sum);
+        });
+        runner.run({"select", "stl::BitVector", "bool", n, queries}, [&](State &) {
+            size_t sum = 0;
+            for (size_t q = 0; q < queries; ++q) sum += bits.select(rng() % ones);
+            bench::do_not_optimize(sum);
+        });
+    }
+    return runner.finish();
+}
@@ -0,0 +1,116 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+// 作为 FIFO 队列使用时 stl::Deque、stl::RingBuffer、stl::List 与 std::deque 的对比，
+// 以及双端插入、下标访问和整体拷贝赋值
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include "Bench.hpp"
+#include "../Deque.hpp"
+#include "../List.hpp"
+#include "../RingBuffer.hpp"
+
+using bench::Case;
+using bench::Runner;
+using bench::State;
+
+template<typename Q>
+static void run_fifo(Runner &runner, const char *impl) {
+    for (const size_t depth : {16, 1024, 65536}) {
+        constexpr size_t ops = 1 << 16;
+        Q queue;
+        for (size_t i = 0; i < depth; ++i) queue.push_back(static_cast<int64_t>(i));
+
+        // 队列保持 depth 个元素，每次操作入队一个、出队一个
+        runner.run({"fifo", impl, "int64", depth, ops}, [&](State &) {
+            int64_t sum = 0;
+            for (size_t i = 0; i < ops; ++i) {
+                queue.push_back(static_cast<int64_t>(i));
+                sum += queue.front();
+                queue.pop_front();
+            }
+            bench::do_not_optimize(sum);
+        });
+    }
+}
+
+template<typename D>
+static void run_deque(Runner &runner, const char *impl) {
+    for (const size_t n : {16, 1024, 65536}) {
+        runner.run({"push_both", impl, "int64", n, n}, [&](State &state) {
+            D d;
+            for (size_t i = 0; i < n; ++i) {
+                if (i & 1) {
+                    d.push_back(static_cast<int64_t>(i));
+                } else {
+                    d.push_front(static_cast<int64_t>(i));
+                }
+            }
+            bench::do_not_optimize(d.size());
+            state.pause();
+        });
+
+        D d;
+        for (size_t i = 0; i < n; ++i) d.push_back(static_cast<int64_t>(i));
+        runner.run({"index", impl, "int64", n, n}, [&](State &) {
+            int64_t sum = 0;
+            for (size_t i = 0; i < n; ++i) sum += d[(i * 7919) & (n - 1)];
+            bench::do_not_optimize(sum);
+        });
+    }
+}
+
+// 拷贝赋值时传播、且总是相等的分配器，覆盖容器保留旧内存的路径
+template<typename T>
+struct PropagatingAllocator : std::allocator<T> {
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    template<typename U>
+    struct rebind {
+        using other = PropagatingAllocator<U>;
+    };
+
+    PropagatingAllocator() = default;
+
+    template<typename U>
+    PropagatingAllocator(const PropagatingAllocator<U> &) noexcept {}
+};
+
+template<typename D>
+static void run_assign(Runner &runner, const char *impl) {
+    for (const size_t n : {16, 1024, 65536}) {
+        D source, d;
+        for (size_t i = 0; i < n; ++i) source.push_back(static_cast<int64_t>(i));
+        for (size_t i = 0; i < n / 2 + 3; ++i) d.push_front(-static_cast<int64_t>(i));
+        runner.run({"copy_assign", impl, "int64", n, n}, [&](State &state) {
+            d = source;
+            state.pause();
+            if (d.size() != n || d.front() != 0 || d.back() != static_cast<int64_t>(n - 1)) {
+                std::fprintf(stderr, "copy_assign: %s produced a wrong result\n", impl);
+                std::abort();
+            }
+            d.push_front(-1); // 下一轮赋值前留下与源不同的布局
+        });
+    }
+}
+
+int main(int argc, char **argv) {
+    Runner runner(argc, argv);
+    run_fifo<stl::Deque<int64_t>>(runner, "stl");
+    run_fifo<stl::RingBuffer<int64_t>>(runner, "ring");
+    run_fifo<stl::List<int64_t>>(runner, "list");
+    run_fifo<std::deque<int64_t>>(runner, "std");
+    run_deque<stl::Deque<int64_t>>(runner, "stl");
+    run_deque<stl::RingBuffer<int64_t>>(runner, "ring");
+    run_deque<std::deque<int64_t>>(runner, "std");
+    run_assign<stl::Deque<int64_t, PropagatingAllocator<int64_t>>>(runner, "stl");
+    run_assign<stl::RingBuffer<int64_t, PropagatingAllocator<int64_t>>>(runner, "ring");
+    run_assign<std::deque<int64_t, PropagatingAllocator<int64_t>>>(runner, "std");
+    return runner.finish();
+}
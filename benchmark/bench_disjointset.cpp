@@ -0,0 +1,97 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+// stl::DisjointSet 的合并与查找。标准库没有并查集，作为参照的是
+// 直接以 std::vector 下标为元素、路径压缩相同的实现，差距即为按值查找元素的开销
+//
+
+#include <vector>
+#include "Bench.hpp"
+#include "../DisjointSet.hpp"
+
+using bench::Case;
+using bench::Runner;
+using bench::State;
+
+class VectorDisjointSet {
+private:
+    std::vector<size_t> m_parent;
+
+public:
+    void insert(size_t a) {
+        if (a >= m_parent.size()) {
+            const size_t old = m_parent.size();
+            m_parent.resize(a + 1);
+            for (size_t i = old; i <= a; ++i) m_parent[i] = i;
+        }
+    }
+
+    size_t find(size_t a) {
+        size_t root = a;
+        while (root != m_parent[root]) root = m_parent[root];
+        for (size_t i = a, next; i != root; i = next) {
+            next = m_parent[i];
+            m_parent[i] = root;
+        }
+        return root;
+    }
+
+    void merge(size_t a, size_t b) {
+        const size_t pa = find(a), pb = find(b);
+        if (pa != pb) m_parent[pb] = pa;
+    }
+};
+
+// 固定种子的线性同余序列，两种实现使用相同的操作序列
+static std::vector<size_t> make_pairs(size_t n) {
+    std::vector<size_t> pairs(n * 2);
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (size_t &x : pairs) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        x = static_cast<size_t>(state >> 33) % n;
+    }
+    return pairs;
+}
+
+template<typename D>
+static void run_all(Runner &runner, const char *impl) {
+    for (const size_t n : {1024, 65536, 1 << 20}) {
+        const std::vector<size_t> pairs = make_pairs(n);
+
+        runner.run({"insert", impl, "size_t", n, n}, [&](State &state) {
+            D set;
+            for (size_t i = 0; i < n; ++i) set.insert(i);
+            bench::do_not_optimize(&set);
+            state.pause();
+        });
+
+        runner.run({"merge", impl, "size_t", n, n / 2}, [&](State &state) {
+            state.pause();
+            D set;
+            for (size_t i = 0; i < n; ++i) set.insert(i);
+            state.resume();
+            for (size_t i = 0; i < n; i += 2) set.merge(pairs[i], pairs[i + 1]);
+            bench::do_not_optimize(&set);
+            state.pause();
+        });
+
+        runner.run({"find", impl, "size_t", n, n}, [&](State &state) {
+            state.pause();
+            D set;
+            for (size_t i = 0; i < n; ++i) set.insert(i);
+            for (size_t i = 0; i < n; i += 2) set.merge(pairs[i], pairs[i + 1]);
+            state.resume();
+            size_t sum = 0;
+            for (size_t i = 0; i < n; ++i) sum += set.find(pairs[i + n]);
+            bench::do_not_optimize(sum);
+            state.pause();
+        });
+    }
+}
+
+int main(int argc, char **argv) {
+    Runner runner(argc, argv);
+    run_all<stl::DisjointSet<size_t>>(runner, "stl");
+    run_all<VectorDisjointSet>(runner, "std");
+    return runner.finish();
+}
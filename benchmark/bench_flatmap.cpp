@@ -0,0 +1,65 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+// stl::FlatMap 与 std::map 的查找、遍历以及批量构建，键为随机 int64
+//
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <vector>
+#include "Bench.hpp"
+#include "../FlatMap.hpp"
+
+using bench::Case;
+using bench::Runner;
+using bench::State;
+
+static std::vector<std::pair<int64_t, int64_t>> random_items(size_t n) {
+    std::mt19937_64 rng(n);
+    std::vector<std::pair<int64_t, int64_t>> items(n);
+    for (size_t i = 0; i < n; ++i) items[i] = {static_cast<int64_t>(rng() >> 1), static_cast<int64_t>(i)};
+    return items;
+}
+
+template<typename M>
+static void run_map(Runner &runner, const char *impl) {
+    for (const size_t n : {64, 4096, 262144}) {
+        const auto items = random_items(n);
+        constexpr size_t lookups = 4096;
+        // 一半命中一半未命中
+        std::vector<int64_t> probes(lookups);
+        std::mt19937_64 rng(7);
+        for (size_t i = 0; i < lookups; ++i) {
+            probes[i] = i & 1 ? items[rng() % n].first : static_cast<int64_t>(rng() >> 1);
+        }
+
+        runner.run({"build", impl, "int64", n, n}, [&](State &) {
+            M m(items.begin(), items.end());
+            bench::do_not_optimize(m.size());
+        });
+
+        const M m(items.begin(), items.end());
+        runner.run({"find", impl, "int64", n, lookups}, [&](State &) {
+            int64_t sum = 0;
+            for (const int64_t key : probes) {
+                auto it = m.find(key);
+                if (it != m.end()) sum += it->second;
+            }
+            bench::do_not_optimize(sum);
+        });
+
+        runner.run({"iterate", impl, "int64", n, n}, [&](State &) {
+            int64_t sum = 0;
+            for (auto it = m.begin(); it != m.end(); ++it) sum += it->second;
+            bench::do_not_optimize(sum);
+        });
+    }
+}
+
+int main(int argc, char **argv) {
+    Runner runner(argc, argv);
+    run_map<stl::FlatMap<int64_t, int64_t>>(runner, "stl");
+    run_map<std::map<int64_t, int64_t>>(runner, "std");
+    return runner.finish();
+}
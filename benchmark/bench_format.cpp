@@ -0,0 +1,106 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+// stl::format_to 与 snprintf 的对比: 每个用例把 n 行日志格式化后追加到同一个缓冲区中。
+// snprintf 写入栈上的缓冲区再追加到 std::string，是 str_format 去掉两次调用和临时分配之后的下限
+//
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "Bench.hpp"
+#include "../Format.hpp"
+
+using bench::Case;
+using bench::Runner;
+using bench::State;
+
+struct Line {
+    const char *method;
+    uint32_t status;
+    uint64_t bytes;
+    double elapsed;
+};
+
+static std::vector<Line> make_lines(size_t n) {
+    static const char *methods[] = {"GET", "POST", "PUT", "DELETE"};
+    std::vector<Line> lines(n);
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (Line &line : lines) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        line.method = methods[state >> 62];
+        line.status = 200 + static_cast<uint32_t>(state >> 40) % 300;
+        line.bytes = state >> 20;
+        line.elapsed = static_cast<double>(state >> 44) / 1024.0;
+    }
+    return lines;
+}
+
+static void append_int(stl::String &out, const Line &line) {
+    stl::format_to(out, STL_FORMAT("status={} bytes={}\n"), line.status, line.bytes);
+}
+
+static void append_int(std::string &out, const Line &line) {
+    char buffer[64];
+    const int n = std::snprintf(buffer, sizeof(buffer), "status=%u bytes=%llu\n", line.status,
+                                static_cast<unsigned long long>(line.bytes));
+    out.append(buffer, n);
+}
+
+static void append_double(stl::String &out, const Line &line) {
+    stl::format_to(out, STL_FORMAT("elapsed={}\n"), line.elapsed);
+}
+
+// %.17g 才能保证还原，但通常比最短表示长
+static void append_double(std::string &out, const Line &line) {
+    char buffer[64];
+    const int n = std::snprintf(buffer, sizeof(buffer), "elapsed=%.17g\n", line.elapsed);
+    out.append(buffer, n);
+}
+
+static void append_line(stl::String &out, const Line &line) {
+    stl::format_to(out, STL_FORMAT("{} /api/v1/items {} {} {}ms\n"), line.method, line.status, line.bytes,
+                   line.elapsed);
+}
+
+static void append_line(std::string &out, const Line &line) {
+    char buffer[128];
+    const int n = std::snprintf(buffer, sizeof(buffer), "%s /api/v1/items %u %llu %.17gms\n", line.method,
+                                line.status, static_cast<unsigned long long>(line.bytes), line.elapsed);
+    out.append(buffer, n);
+}
+
+template<typename S>
+static void run_all(Runner &runner, const char *impl) {
+    for (const size_t n : {1024, 65536}) {
+        const std::vector<Line> lines = make_lines(n);
+
+        runner.run({"int", impl, "line", n, n}, [&](State &state) {
+            S out;
+            for (const Line &line : lines) append_int(out, line);
+            bench::do_not_optimize(out.data());
+            state.pause();
+        });
+
+        runner.run({"double", impl, "line", n, n}, [&](State &state) {
+            S out;
+            for (const Line &line : lines) append_double(out, line);
+            bench::do_not_optimize(out.data());
+            state.pause();
+        });
+
+        runner.run({"log_line", impl, "line", n, n}, [&](State &state) {
+            S out;
+            for (const Line &line : lines) append_line(out, line);
+            bench::do_not_optimize(out.data());
+            state.pause();
+        });
+    }
+}
+
+int main(int argc, char **argv) {
+    Runner runner(argc, argv);
+    run_all<stl::String>(runner, "stl");
+    run_all<std::string>(runner, "std");
+    return runner.finish();
+}
@@ -0,0 +1,93 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+// stl::HashMap 与 std::unordered_map 的插入、命中与未命中查找、插入删除交替，
+// 以及以字符串为键时用 const char * 查找
+//
+
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Bench.hpp"
+#include "../HashMap.hpp"
+#include "../String.h"
+
+using bench::Case;
+using bench::Runner;
+using bench::State;
+
+static std::vector<int64_t> random_keys(size_t n, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<int64_t> keys(n);
+    for (int64_t &key : keys) key = static_cast<int64_t>(rng() >> 1);
+    return keys;
+}
+
+template<typename M>
+static void run_int(Runner &runner, const char *impl) {
+    for (const size_t n : {64, 4096, 262144}) {
+        const auto keys = random_keys(n, n);
+        const auto misses = random_keys(n, n + 1);
+
+        runner.run({"insert", impl, "int64", n, n}, [&](State &) {
+            M m;
+            for (size_t i = 0; i < n; ++i) m[keys[i]] = static_cast<int64_t>(i);
+            bench::do_not_optimize(m.size());
+        });
+
+        M m;
+        for (size_t i = 0; i < n; ++i) m[keys[i]] = static_cast<int64_t>(i);
+
+        runner.run({"find_hit", impl, "int64", n, n}, [&](State &) {
+            int64_t sum = 0;
+            for (const int64_t key : keys) sum += m.find(key)->second;
+            bench::do_not_optimize(sum);
+        });
+
+        runner.run({"find_miss", impl, "int64", n, n}, [&](State &) {
+            size_t found = 0;
+            for (const int64_t key : misses) found += m.find(key) != m.end();
+            bench::do_not_optimize(found);
+        });
+
+        // 每次删除一个已有的键并插入一个新键，元素个数保持不变
+        runner.run({"churn", impl, "int64", n, n}, [&](State &) {
+            for (size_t i = 0; i < n; ++i) {
+                m.erase(keys[i]);
+                m[misses[i]] = 0;
+            }
+            for (size_t i = 0; i < n; ++i) {
+                m.erase(misses[i]);
+                m[keys[i]] = static_cast<int64_t>(i);
+            }
+            bench::do_not_optimize(m.size());
+        });
+    }
+}
+
+template<typename M>
+static void run_string(Runner &runner, const char *impl) {
+    for (const size_t n : {64, 4096, 262144}) {
+        std::vector<std::string> names(n);
+        std::mt19937_64 rng(n);
+        for (std::string &name : names) name = "key_" + std::to_string(rng() % 1000000000) + "_suffix";
+
+        M m;
+        for (size_t i = 0; i < n; ++i) m[names[i].c_str()] = static_cast<int64_t>(i);
+        runner.run({"find_cstr", impl, "string", n, n}, [&](State &) {
+            int64_t sum = 0;
+            for (const std::string &name : names) sum += m.find(name.c_str())->second;
+            bench::do_not_optimize(sum);
+        });
+    }
+}
+
+int main(int argc, char **argv) {
+    Runner runner(argc, argv);
+    run_int<stl::HashMap<int64_t, int64_t>>(runner, "stl");
+    run_int<std::unordered_map<int64_t, int64_t>>(runner, "std");
+    run_string<stl::HashMap<stl::String, int64_t>>(runner, "stl");
+    run_string<std::unordered_map<std::string, int64_t>>(runner, "std");
+    return runner.finish();
+}
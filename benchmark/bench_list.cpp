@@ -0,0 +1,80 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+// stl::List 与 std::list 的对比: push_back、隔一个删除一个、逐个 splice、遍历
+//
+
+#include <list>
+#include <string>
+#include "Bench.hpp"
+#include "../List.hpp"
+
+using bench::Case;
+using bench::Runner;
+using bench::State;
+
+template<typename T>
+static T make_value(size_t i) {
+    if constexpr (std::is_arithmetic_v<T>) {
+        return static_cast<T>(i);
+    } else {
+        T s = "list-value-" + std::to_string(i);
+        s.resize(32, '#');
+        return s;
+    }
+}
+
+template<typename L>
+static void run_all(Runner &runner, const char *impl, const char *type) {
+    using T = typename L::value_type;
+    for (const size_t n : {16, 1024, 65536}) {
+        L source;
+        for (size_t i = 0; i < n; ++i) source.push_back(make_value<T>(i));
+
+        runner.run({"push_back", impl, type, n, n}, [&](State &state) {
+            L list;
+            for (const T &value : source) list.push_back(value);
+            bench::do_not_optimize(list.size());
+            state.pause();
+        });
+
+        runner.run({"erase_alternate", impl, type, n, n / 2}, [&](State &state) {
+            state.pause();
+            L list = source;
+            state.resume();
+            for (auto it = list.begin(); it != list.end();) {
+                it = list.erase(it);
+                if (it != list.end()) ++it;
+            }
+            bench::do_not_optimize(list.size());
+            state.pause();
+        });
+
+        runner.run({"splice", impl, type, n, n}, [&](State &state) {
+            state.pause();
+            L from = source, to;
+            state.resume();
+            while (!from.empty()) to.splice(to.end(), from, from.begin());
+            bench::do_not_optimize(to.size());
+            state.pause();
+        });
+
+        runner.run({"iterate", impl, type, n, n}, [&](State &) {
+            size_t count = 0;
+            for (const T &value : source) {
+                bench::do_not_optimize(value);
+                ++count;
+            }
+            bench::do_not_optimize(count);
+        });
+    }
+}
+
+int main(int argc, char **argv) {
+    Runner runner(argc, argv);
+    run_all<stl::List<int64_t>>(runner, "stl", "int64");
+    run_all<std::list<int64_t>>(runner, "std", "int64");
+    run_all<stl::List<std::string>>(runner, "stl", "string");
+    run_all<std::list<std::string>>(runner, "std", "string");
+    return runner.finish();
+}
@@ -0,0 +1,88 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+// stl::parallel::sort 与 std::sort 的对比。默认线程池至少有 4 个线程，单核机器上也会走并行归并的路径。
+// 字符串用例的比较函数按值接收参数，排序后检查结果，归并时若以右值调用比较函数会把元素移走
+//
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Bench.hpp"
+#include "../Parallel.hpp"
+
+using bench::Case;
+using bench::Runner;
+using bench::State;
+
+static std::vector<uint64_t> make_numbers(size_t n) {
+    std::vector<uint64_t> numbers(n);
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (uint64_t &x : numbers) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        x = state >> 16;
+    }
+    return numbers;
+}
+
+static std::vector<std::string> make_strings(size_t n) {
+    std::vector<std::string> strings;
+    strings.reserve(n);
+    for (const uint64_t x : make_numbers(n)) {
+        strings.push_back("key-" + std::to_string(x) + "-padding-past-sso");
+    }
+    return strings;
+}
+
+template<bool Parallel, typename It, typename Compare>
+static void sort(It first, It last, Compare comp) {
+    if constexpr (Parallel) {
+        stl::parallel::sort(first, last, comp, 1024);
+    } else {
+        std::sort(first, last, comp);
+    }
+}
+
+template<bool Parallel>
+static void run_all(Runner &runner, const char *impl) {
+    for (const size_t n : {1 << 16, 1 << 20}) {
+        const std::vector<uint64_t> numbers = make_numbers(n);
+        runner.run({"sort", impl, "uint64_t", n, n}, [&](State &state) {
+            state.pause();
+            std::vector<uint64_t> data = numbers;
+            state.resume();
+            sort<Parallel>(data.begin(), data.end(), std::less<>());
+            bench::do_not_optimize(data.data());
+            state.pause();
+        });
+    }
+
+    const size_t n = 1 << 16;
+    const std::vector<std::string> strings = make_strings(n);
+    runner.run({"sort_by_value", impl, "string", n, n}, [&](State &state) {
+        state.pause();
+        std::vector<std::string> data = strings;
+        state.resume();
+        sort<Parallel>(data.begin(), data.end(), [](std::string a, std::string b) { return a < b; });
+        state.pause();
+        if (!std::is_sorted(data.begin(), data.end()) ||
+            std::count(data.begin(), data.end(), std::string()) != 0) {
+            std::fprintf(stderr, "sort_by_value: %s produced a wrong result\n", impl);
+            std::abort();
+        }
+    });
+}
+
+int main(int argc, char **argv) {
+    stl::ThreadPool pool(std::max(4U, std::thread::hardware_concurrency()));
+    stl::set_default_pool(&pool);
+    Runner runner(argc, argv);
+    run_all<true>(runner, "stl");
+    run_all<false>(runner, "std");
+    const int result = runner.finish();
+    stl::set_default_pool(nullptr);
+    return result;
+}
@@ -0,0 +1,90 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+// stl::Rope 与 std::string 的对比: 逐段追加、每次生成新对象的拼接 (x = x + piece)、在中间插入以及取子串。
+// 每个用例都用 16 字节的片段构建出 n 字节的文本
+//
+
+#include <string>
+#include "Bench.hpp"
+#include "../Rope.hpp"
+
+using bench::Case;
+using bench::Runner;
+using bench::State;
+
+static const char piece[] = "<td>0123456</td>";
+static constexpr size_t piece_size = sizeof(piece) - 1;
+
+static void append(std::string &text, const char *str) {
+    text.append(str, piece_size);
+}
+
+static void append(stl::Rope &text, const char *str) {
+    text.append(stl::StringView(str, piece_size));
+}
+
+static void insert(std::string &text, size_t index, const char *str) {
+    text.insert(index, str, piece_size);
+}
+
+static void insert(stl::Rope &text, size_t index, const char *str) {
+    text.insert(index, stl::StringView(str, piece_size));
+}
+
+template<typename S>
+static S make(const char *str) {
+    if constexpr (std::is_same_v<S, std::string>) {
+        return S(str, piece_size);
+    } else {
+        return S(stl::StringView(str, piece_size));
+    }
+}
+
+template<typename S>
+static void run_all(Runner &runner, const char *impl) {
+    for (const size_t n : {4096, 65536, 262144}) {
+        const size_t pieces = n / piece_size;
+
+        runner.run({"append", impl, "char", n, pieces}, [&](State &state) {
+            S text;
+            for (size_t i = 0; i < pieces; ++i) append(text, piece);
+            bench::do_not_optimize(&text);
+            state.pause();
+        });
+
+        runner.run({"concat", impl, "char", n, pieces}, [&](State &state) {
+            const S part = make<S>(piece);
+            S text;
+            for (size_t i = 0; i < pieces; ++i) text = text + part;
+            bench::do_not_optimize(&text);
+            state.pause();
+        });
+
+        runner.run({"insert_middle", impl, "char", n, pieces}, [&](State &state) {
+            S text;
+            for (size_t i = 0; i < pieces; ++i) insert(text, i / 2 * piece_size, piece);
+            bench::do_not_optimize(&text);
+            state.pause();
+        });
+
+        runner.run({"substr", impl, "char", n, pieces}, [&](State &state) {
+            state.pause();
+            S text;
+            for (size_t i = 0; i < pieces; ++i) append(text, piece);
+            state.resume();
+            for (size_t i = 0; i < pieces; ++i) {
+                S part = text.substr(i * piece_size / 2, n / 2);
+                bench::do_not_optimize(&part);
+            }
+            state.pause();
+        });
+    }
+}
+
+int main(int argc, char **argv) {
+    Runner runner(argc, argv);
+    run_all<stl::Rope>(runner, "stl");
+    run_all<std::string>(runner, "std");
+    return runner.finish();
+}
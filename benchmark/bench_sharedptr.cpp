@@ -0,0 +1,60 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+// stl::SharedPtr 与 std::shared_ptr 的对比: 创建、拷贝 (引用计数加减)
+//
+
+#include <memory>
+#include "Bench.hpp"
+#include "../SharedPtr.hpp"
+
+using bench::Case;
+using bench::Runner;
+using bench::State;
+
+template<typename T>
+static stl::SharedPtr<T> make(const T &value, stl::SharedPtr<T> *) {
+    return stl::makeSharedPtr<T>(value);
+}
+
+template<typename T>
+static std::shared_ptr<T> make(const T &value, std::shared_ptr<T> *) {
+    return std::make_shared<T>(value);
+}
+
+template<typename P>
+static void run_all(Runner &runner, const char *impl) {
+    constexpr size_t batch = 1024;
+
+    runner.run({"make", impl, "int64", batch, batch}, [&](State &) {
+        for (size_t i = 0; i < batch; ++i) {
+            P p = make<int64_t>(static_cast<int64_t>(i), static_cast<P *>(nullptr));
+            bench::do_not_optimize(p.get());
+        }
+    });
+
+    const P shared = make<int64_t>(42, static_cast<P *>(nullptr));
+    runner.run({"copy", impl, "int64", batch, batch}, [&](State &) {
+        for (size_t i = 0; i < batch; ++i) {
+            P copy(shared);
+            bench::do_not_optimize(copy.get());
+        }
+    });
+
+    // 同时持有多份拷贝，引用计数先增到 batch 再逐个减回
+    runner.run({"copy_hold", impl, "int64", batch, batch}, [&](State &) {
+        alignas(P) static unsigned char storage[sizeof(P) * batch];
+        P *copies = reinterpret_cast<P *>(storage);
+        for (size_t i = 0; i < batch; ++i) ::new(copies + i) P(shared);
+        bench::do_not_optimize(copies[batch - 1].get());
+        for (size_t i = 0; i < batch; ++i) copies[i].~P();
+        bench::do_not_optimize(shared.get());
+    });
+}
+
+int main(int argc, char **argv) {
+    Runner runner(argc, argv);
+    run_all<stl::SharedPtr<int64_t>>(runner, "stl");
+    run_all<std::shared_ptr<int64_t>>(runner, "std");
+    return runner.finish();
+}
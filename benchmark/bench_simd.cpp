@@ -0,0 +1,149 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+// SIMD 内核与原有逐元素循环的对比，随 CMake 工程构建为 bench_simd，也可以单独编译:
+//     g++ -std=c++17 -O2 -I.. bench_simd.cpp -o bench_simd && ./bench_simd
+//
+
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include "../Array.hpp"
+#include "../Vector.hpp"
+
+using namespace stl;
+
+template<typename T>
+static void do_not_optimize(const T &value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// 返回每次调用的平均耗时 (ns)
+template<typename F>
+static double measure(F &&f) {
+    using clock = std::chrono::steady_clock;
+    size_t iterations = 1;
+    while (true) {
+        const auto start = clock::now();
+        for (size_t i = 0; i < iterations; ++i) f();
+        const double ns = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+        if (ns > 5e7) return ns / iterations;
+        iterations *= 2;
+    }
+}
+
+// 改造前 Vector::operator== 与 Array::fill 使用的逐元素循环
+namespace loop {
+    template<typename T>
+    bool equal(const Vector<T> &a, const Vector<T> &b) {
+        if (a.size() != b.size()) return false;
+        for (size_t i = 0, n = a.size(); i < n; ++i) {
+            if (a[i] != b[i]) return false;
+        }
+        return true;
+    }
+
+    template<typename T>
+    size_t find(const Vector<T> &a, T value) {
+        for (size_t i = 0; i < a.size(); ++i) {
+            if (a[i] == value) return i;
+        }
+        return a.size();
+    }
+
+    template<typename T>
+    size_t count(const Vector<T> &a, T value) {
+        size_t n = 0;
+        for (size_t i = 0; i < a.size(); ++i) n += a[i] == value;
+        return n;
+    }
+
+    template<typename T>
+    T max(const Vector<T> &a) {
+        T best = a[0];
+        for (size_t i = 1; i < a.size(); ++i) best = a[i] > best ? a[i] : best;
+        return best;
+    }
+
+    template<typename T>
+    T sum(const Vector<T> &a) {
+        T total = T();
+        for (size_t i = 0; i < a.size(); ++i) total += a[i];
+        return total;
+    }
+}
+
+template<typename T>
+static void run(const char *type, size_t n) {
+    Vector<T> a(n), b(n), out(n);
+    for (size_t i = 0; i < n; ++i) a[i] = b[i] = T(i % 1000);
+    const T missing = T(-1);
+
+    struct Case {
+        const char *name;
+        double loop;
+        double simd[4];
+    };
+    Case cases[] = {{"equal", 0, {}}, {"find", 0, {}}, {"count", 0, {}},
+                    {"max", 0, {}}, {"sum", 0, {}}, {"add", 0, {}}};
+
+    cases[0].loop = measure([&] { do_not_optimize(loop::equal(a, b)); });
+    cases[1].loop = measure([&] { do_not_optimize(loop::find(a, missing)); });
+    cases[2].loop = measure([&] { do_not_optimize(loop::count(a, T(7))); });
+    cases[3].loop = measure([&] { do_not_optimize(loop::max(a)); });
+    cases[4].loop = measure([&] { do_not_optimize(loop::sum(a)); });
+    cases[5].loop = measure([&] {
+        for (size_t i = 0; i < n; ++i) out[i] = a[i] + b[i];
+        do_not_optimize(out.data());
+    });
+
+    const int top = static_cast<int>(simd::detected_isa());
+    for (int isa = 0; isa <= top; ++isa) {
+        simd::set_isa(static_cast<simd::Isa>(isa));
+        cases[0].simd[isa] = measure([&] { do_not_optimize(simd::equal(a.data(), b.data(), n)); });
+        cases[1].simd[isa] = measure([&] { do_not_optimize(simd::find(a, missing)); });
+        cases[2].simd[isa] = measure([&] { do_not_optimize(simd::count(a, T(7))); });
+        cases[3].simd[isa] = measure([&] { do_not_optimize(simd::max(a)); });
+        cases[4].simd[isa] = measure([&] { do_not_optimize(simd::sum(a)); });
+        cases[5].simd[isa] = measure([&] {
+            simd::add(a, b, out);
+            do_not_optimize(out.data());
+        });
+    }
+    simd::set_isa(simd::detected_isa());
+
+    for (const Case &c : cases) {
+        std::printf("%-8s %-6s %9zu  loop %11.1f ns", type, c.name, n, c.loop);
+        for (int isa = 0; isa <= top; ++isa) {
+            std::printf("  %s %11.1f ns (%5.2fx)", simd::isa_name(static_cast<simd::Isa>(isa)),
+                        c.simd[isa], c.loop / c.simd[isa]);
+        }
+        std::printf("\n");
+    }
+}
+
+template<size_t N>
+static void run_array_fill() {
+    static Array<float, N> array;
+    const double before = measure([&] {
+        for (size_t i = 0; i < N; ++i) array[i] = 1.5f;
+        do_not_optimize(array.data());
+    });
+    const double after = measure([&] {
+        array.fill(1.5f);
+        do_not_optimize(array.data());
+    });
+    std::printf("Array<float, %zu>::fill  loop %.1f ns  simd %.1f ns (%.2fx)\n", N, before, after, before / after);
+}
+
+int main() {
+    std::printf("detected isa: %s\n", simd::isa_name(simd::detected_isa()));
+    for (size_t n : {1000, 100000, 10000000}) {
+        run<int32_t>("int32", n);
+        run<float>("float", n);
+        run<double>("double", n);
+    }
+    run_array_fill<4096>();
+    run_array_fill<1 << 20>();
+    return 0;
+}
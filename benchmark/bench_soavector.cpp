@@ -0,0 +1,77 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+// 只读取一个字段的扫描: Vector<Record> (按行存储) 与 SoAVector (按列存储) 的对比，
+// 记录为 (timestamp, id, value, flags)
+//
+
+#include <random>
+#include "Bench.hpp"
+#include "../SoAVector.hpp"
+#include "../Simd.hpp"
+#include "../Vector.hpp"
+
+using bench::Case;
+using bench::Runner;
+using bench::State;
+
+struct Record {
+    int64_t timestamp;
+    int64_t id;
+    double value;
+    uint32_t flags;
+};
+
+using Columns = stl::SoAVector<int64_t, int64_t, double, uint32_t>;
+
+int main(int argc, char **argv) {
+    Runner runner(argc, argv);
+    for (const size_t n : {1024, 65536, 4194304}) {
+        stl::Vector<Record> rows;
+        Columns columns;
+        std::mt19937_64 rng(n);
+        for (size_t i = 0; i < n; ++i) {
+            const Record r{static_cast<int64_t>(i), static_cast<int64_t>(rng() >> 1),
+                           static_cast<double>(rng() % 1000), static_cast<uint32_t>(rng() & 7)};
+            rows.push_back(r);
+            columns.emplace_back(r.timestamp, r.id, r.value, r.flags);
+        }
+
+        runner.run({"sum_value", "aos", "record", n, n}, [&](State &) {
+            double sum = 0;
+            for (size_t i = 0; i < n; ++i) sum += rows[i].value;
+            bench::do_not_optimize(sum);
+        });
+        runner.run({"sum_value", "soa", "record", n, n}, [&](State &) {
+            double sum = 0;
+            for (const double value : columns.column<2>()) sum += value;
+            bench::do_not_optimize(sum);
+        });
+        runner.run({"sum_value", "simd", "record", n, n}, [&](State &) {
+            bench::do_not_optimize(stl::simd::sum(columns.column<2>()));
+        });
+
+        runner.run({"count_id", "aos", "record", n, n}, [&](State &) {
+            size_t count = 0;
+            for (size_t i = 0; i < n; ++i) count += rows[i].id > (INT64_MAX >> 1);
+            bench::do_not_optimize(count);
+        });
+        runner.run({"count_id", "soa", "record", n, n}, [&](State &) {
+            size_t count = 0;
+            for (const int64_t id : columns.column<1>()) count += id > (INT64_MAX >> 1);
+            bench::do_not_optimize(count);
+        });
+
+        runner.run({"push_back", "aos", "record", n, n}, [&](State &) {
+            stl::Vector<Record> v;
+            for (size_t i = 0; i < n; ++i) v.push_back({int64_t(i), int64_t(i), 1.0, 0});
+            bench::do_not_optimize(v.size());
+        });
+        runner.run({"push_back", "soa", "record", n, n}, [&](State &) {
+            Columns v;
+            for (size_t i = 0; i < n; ++i) v.emplace_back(int64_t(i), int64_t(i), 1.0, 0u);
+            bench::do_not_optimize(v.size());
+        });
+    }
+    return runner.finish();
+}
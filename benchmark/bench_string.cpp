@@ -0,0 +1,146 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+// stl::String 与 std::string 的对比: push_back、append、拷贝、查找 (短/长模式串、反向、计数)、split 以及
+// 不复制字符的 split_view
+//
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Bench.hpp"
+#include "../String.h"
+#include "../StringView.hpp"
+
+using bench::Case;
+using bench::Runner;
+using bench::State;
+
+// std::string 没有 split，按 stl::String::split 的语义实现
+static std::vector<std::string> split(const std::string &str, char delimiter) {
+    std::vector<std::string> parts;
+    size_t begin = 0;
+    for (size_t pos; (pos = str.find(delimiter, begin)) != std::string::npos; begin = pos + 1) {
+        parts.push_back(str.substr(begin, pos - begin));
+    }
+    parts.push_back(str.substr(begin));
+    return parts;
+}
+
+static stl::Vector<stl::String> split(const stl::String &str, char delimiter) {
+    return str.split(delimiter);
+}
+
+static std::vector<std::string_view> split_view(const std::string &str, char delimiter) {
+    const std::string_view text(str);
+    std::vector<std::string_view> parts;
+    size_t begin = 0;
+    for (size_t pos; (pos = text.find(delimiter, begin)) != std::string_view::npos; begin = pos + 1) {
+        parts.push_back(text.substr(begin, pos - begin));
+    }
+    parts.push_back(text.substr(begin));
+    return parts;
+}
+
+static stl::Vector<stl::StringView> split_view(const stl::String &str, char delimiter) {
+    return stl::split_view(str, delimiter);
+}
+
+static size_t find(const std::string &str, const char *needle) {
+    return str.find(needle);
+}
+
+static size_t find(const stl::String &str, const char *needle) {
+    return str.find(needle);
+}
+
+static size_t rfind(const std::string &str, const char *needle) {
+    return str.rfind(needle);
+}
+
+static size_t rfind(const stl::String &str, const char *needle) {
+    return str.rfind(needle);
+}
+
+static size_t count(const std::string &str, char c) {
+    return static_cast<size_t>(std::count(str.begin(), str.end(), c));
+}
+
+static size_t count(const stl::String &str, char c) {
+    return str.count(c);
+}
+
+// 由 8 个字符的片段拼成、长度为 n 的文本，片段之间以逗号分隔
+static std::string make_text(size_t n) {
+    std::string text;
+    for (size_t i = 0; text.size() < n; ++i) {
+        text += "word" + std::to_string(1000 + i % 9000).substr(0, 3) + ",";
+    }
+    text.resize(n);
+    return text;
+}
+
+template<typename S>
+static void run_all(Runner &runner, const char *impl) {
+    static const char chunk[] = "abcdefgh";
+    for (const size_t n : {16, 1024, 65536}) {
+        const S text(make_text(n).c_str());
+
+        runner.run({"push_back", impl, "char", n, n}, [&](State &state) {
+            S s;
+            for (size_t i = 0; i < n; ++i) s.push_back(static_cast<char>('a' + i % 26));
+            bench::do_not_optimize(s.data());
+            state.pause();
+        });
+
+        runner.run({"append", impl, "char", n, n / 8}, [&](State &state) {
+            S s;
+            for (size_t i = 0; i < n / 8; ++i) s.append(chunk);
+            bench::do_not_optimize(s.data());
+            state.pause();
+        });
+
+        runner.run({"copy", impl, "char", n, n}, [&](State &state) {
+            S s(text);
+            bench::do_not_optimize(s.data());
+            state.pause();
+        });
+
+        runner.run({"find", impl, "char", n, n}, [&](State &) {
+            bench::do_not_optimize(find(text, "word99,"));
+        });
+
+        // 超过 SIMD 过滤阈值的长模式串，走 Two-Way
+        runner.run({"find_long", impl, "char", n, n}, [&](State &) {
+            bench::do_not_optimize(find(text, "word100,word101,word102,word103,word104,word99,"));
+        });
+
+        runner.run({"rfind", impl, "char", n, n}, [&](State &) {
+            bench::do_not_optimize(rfind(text, "word99,"));
+        });
+
+        runner.run({"count", impl, "char", n, n}, [&](State &) {
+            bench::do_not_optimize(count(text, ','));
+        });
+
+        runner.run({"split", impl, "char", n, n / 8}, [&](State &state) {
+            auto parts = split(text, ',');
+            bench::do_not_optimize(parts.data());
+            state.pause();
+        });
+
+        runner.run({"split_view", impl, "char", n, n / 8}, [&](State &state) {
+            auto parts = split_view(text, ',');
+            bench::do_not_optimize(parts.data());
+            state.pause();
+        });
+    }
+}
+
+int main(int argc, char **argv) {
+    Runner runner(argc, argv);
+    run_all<stl::String>(runner, "stl");
+    run_all<std::string>(runner, "std");
+    return runner.finish();
+}
@@ -0,0 +1,84 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+// stl::StringPool 的驻留与相等比较。标准库没有驻留池，作为参照的是 std::unordered_set<std::string>
+// 实现的驻留 (返回元素的地址)，相等比较的参照是直接比较 std::string 的内容
+//
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include "Bench.hpp"
+#include "../StringPool.hpp"
+
+using bench::Case;
+using bench::Runner;
+using bench::State;
+
+class StdPool {
+private:
+    std::unordered_set<std::string> m_set;
+
+public:
+    const std::string *intern(const std::string &str) {
+        return &*m_set.insert(str).first;
+    }
+};
+
+static stl::Atom intern(stl::StringPool &pool, const std::string &str) {
+    return pool.intern(stl::StringView(str.data(), str.size()));
+}
+
+static const std::string *intern(StdPool &pool, const std::string &str) {
+    return pool.intern(str);
+}
+
+// n 个主机名，其中不同的只有 n / 8 个
+static std::vector<std::string> make_keys(size_t n) {
+    std::vector<std::string> keys(n);
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (std::string &key : keys) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        key = "host-" + std::to_string((state >> 33) % (n / 8 + 1)) + ".metrics.example.com";
+    }
+    return keys;
+}
+
+template<typename P>
+static void run_all(Runner &runner, const char *impl) {
+    for (const size_t n : {1024, 65536, 1 << 20}) {
+        const std::vector<std::string> keys = make_keys(n);
+
+        runner.run({"intern", impl, "string", n, n}, [&](State &state) {
+            P pool;
+            for (const std::string &key : keys) bench::do_not_optimize(intern(pool, key));
+            state.pause();
+        });
+
+        // 驻留后的比较: Atom 比较指针，std::string 比较内容 (前缀相同，长度多数也相同)
+        runner.run({"equal", impl, "string", n, n}, [&](State &state) {
+            state.pause();
+            P pool;
+            std::vector<decltype(intern(pool, keys[0]))> handles;
+            for (const std::string &key : keys) handles.push_back(intern(pool, key));
+            state.resume();
+            size_t same = 0;
+            for (size_t i = 1; i < n; ++i) {
+                if constexpr (std::is_same_v<P, StdPool>) {
+                    same += keys[i] == keys[i - 1];
+                } else {
+                    same += handles[i] == handles[i - 1];
+                }
+            }
+            bench::do_not_optimize(same);
+            state.pause();
+        });
+    }
+}
+
+int main(int argc, char **argv) {
+    Runner runner(argc, argv);
+    run_all<stl::StringPool>(runner, "stl");
+    run_all<StdPool>(runner, "std");
+    return runner.finish();
+}
@@ -0,0 +1,126 @@
+//
+// Created by ASUS on 2026/10/17.
+//
+// stl::Vector、stl::SmallVector 与 std::vector 的对比: push_back、中间插入、区间插入、中间删除、拷贝、查找
+//
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "Bench.hpp"
+#include "../Simd.hpp"
+#include "../SmallVector.hpp"
+#include "../Vector.hpp"
+
+using bench::Case;
+using bench::Runner;
+using bench::State;
+
+template<typename T>
+static T make_value(size_t i);
+
+template<>
+int64_t make_value<int64_t>(size_t i) {
+    return static_cast<int64_t>(i * 2654435761u % 1000003);
+}
+
+// 超出 SSO 的长度，每个元素都持有一块堆内存
+template<>
+std::string make_value<std::string>(size_t i) {
+    std::string s = "benchmark-value-" + std::to_string(i);
+    s.resize(32, '#');
+    return s;
+}
+
+// 不会出现在 make_value 结果中的值，用于查找失败的情形
+template<typename T>
+static T make_missing() {
+    if constexpr (std::is_arithmetic_v<T>) {
+        return T(-1);
+    } else {
+        return T("missing");
+    }
+}
+
+template<typename V>
+static V make_source(size_t n) {
+    V v;
+    for (size_t i = 0; i < n; ++i) v.push_back(make_value<typename V::value_type>(i));
+    return v;
+}
+
+template<typename V>
+static size_t find_index(const V &v, const typename V::value_type &value) {
+    using T = typename V::value_type;
+    if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<V, std::vector<T>>) {
+        return stl::simd::find(v, value);
+    } else {
+        return std::find(v.begin(), v.end(), value) - v.begin();
+    }
+}
+
+template<typename V>
+static void run_all(Runner &runner, const char *impl, const char *type) {
+    using T = typename V::value_type;
+    for (const size_t n : {16, 1024, 65536}) {
+        const V source = make_source<V>(n);
+
+        runner.run({"push_back", impl, type, n, n}, [&](State &state) {
+            V v;
+            for (size_t i = 0; i < n; ++i) v.push_back(source[i]);
+            bench::do_not_optimize(v.data());
+            state.pause();
+        });
+
+        const size_t edits = std::min<size_t>(64, n / 2);
+        runner.run({"insert_middle", impl, type, n, edits}, [&](State &state) {
+            state.pause();
+            V v = source;
+            state.resume();
+            for (size_t i = 0; i < edits; ++i) v.insert(v.begin() + v.size() / 2, source[i]);
+            bench::do_not_optimize(v.data());
+            state.pause();
+        });
+
+        // 源区间是指针，对 SmallVector 会实例化插入自身元素的分支
+        runner.run({"insert_range", impl, type, n, edits}, [&](State &state) {
+            state.pause();
+            V v = source;
+            state.resume();
+            v.insert(v.begin() + v.size() / 2, source.data(), source.data() + edits);
+            bench::do_not_optimize(v.data());
+            state.pause();
+        });
+
+        runner.run({"erase_middle", impl, type, n, edits}, [&](State &state) {
+            state.pause();
+            V v = source;
+            state.resume();
+            for (size_t i = 0; i < edits; ++i) v.erase(v.begin() + v.size() / 2);
+            bench::do_not_optimize(v.data());
+            state.pause();
+        });
+
+        runner.run({"copy", impl, type, n, n}, [&](State &state) {
+            V v = source;
+            bench::do_not_optimize(v.data());
+            state.pause();
+        });
+
+        const T missing = make_missing<T>();
+        runner.run({"find", impl, type, n, n}, [&](State &) {
+            bench::do_not_optimize(find_index(source, missing));
+        });
+    }
+}
+
+int main(int argc, char **argv) {
+    Runner runner(argc, argv);
+    run_all<stl::Vector<int64_t>>(runner, "stl", "int64");
+    run_all<stl::SmallVector<int64_t, 16>>(runner, "small", "int64");
+    run_all<std::vector<int64_t>>(runner, "std", "int64");
+    run_all<stl::Vector<std::string>>(runner, "stl", "string");
+    run_all<stl::SmallVector<std::string, 16>>(runner, "small", "string");
+    run_all<std::vector<std::string>>(runner, "std", "string");
+    return runner.finish();
+}